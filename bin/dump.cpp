@@ -30,6 +30,9 @@
 #include <list>
 #include <map>
 #include <cmath>
+#include <vector>
+#include <algorithm>
+#include <iomanip>
 #include "dump.h"
 
 extern "C" {
@@ -69,7 +72,7 @@ static std::map<std::uint32_t, std::string> symbol_table;
  * read_class *
  **************/
 
-static void read_class(std::istream &in) {
+static void read_class(std::istream &in, std::uint8_t minor_ver) {
   Class cls;
 
   // Class and super hash ids.
@@ -82,9 +85,17 @@ static void read_class(std::istream &in) {
   cls.object_properties = in.get();
   cls.class_properties = in.get();
 
-  // Read in the virtual tables sizes.
-  uint8_t no_entries = in.get();
-  uint8_t no_centries = in.get();
+  // Read in the virtual tables sizes, 16bit since version 1.1.
+  std::uint16_t no_entries, no_centries;
+  if (minor_ver >= 1) {
+    in.read((char *)&no_entries, 2);
+    no_entries = endian::read_be(no_entries);
+    in.read((char *)&no_centries, 2);
+    no_centries = endian::read_be(no_centries);
+  } else {
+    no_entries = in.get();
+    no_centries = in.get();
+  }
 
   cls.vtable.resize(no_entries);
   cls.cvtable.resize(no_centries);
@@ -205,10 +216,13 @@ static void disassemble(uint8_t *ip, const std::string &pre = "    ") {
 
     case meat::bytecode::MESG_SUPER_RESULT:
     case meat::bytecode::MESG_RESULT:
+    case meat::bytecode::MESG_TAIL:
       std::cout << pre << local(bc->o.mr.result) << " = ";
       switch (bc->code) {
       case meat::bytecode::MESG_RESULT:
         std::cout << "[MESSAGE " << local(bc->o.mr.object); break;
+      case meat::bytecode::MESG_TAIL:
+        std::cout << "[TAIL MESSAGE " << local(bc->o.mr.object); break;
       case meat::bytecode::MESG_SUPER_RESULT:
         std::cout << "[MESSAGE super"; break;
       default: break;
@@ -236,6 +250,44 @@ static void disassemble(uint8_t *ip, const std::string &pre = "    ") {
       std::cout << pre << "CONTEXT END" << std::endl;
       return;
 
+    /* The jumps and inlined blocks show their offsets relative to the start
+     * of the instruction.
+     */
+    case meat::bytecode::BLOCK_INLINE:
+      std::cout << pre << local(bc->o.bi.result) << " = [BLOCK INLINE "
+                << std::showpos << endian::read_be(bc->o.bi.body)
+                << std::noshowpos << "]\n";
+      ip += 4;
+      break;
+
+    case meat::bytecode::JUMP:
+      std::cout << pre << "JUMP " << std::showpos
+                << endian::read_be(bc->o.j.target);
+      if (bc->o.j.block)
+        std::cout << " ENDS BLOCK " << endian::read_be(bc->o.j.block);
+      std::cout << std::noshowpos << "\n";
+      ip += 5;
+      break;
+
+    case meat::bytecode::JUMP_IF_TRUE:
+    case meat::bytecode::JUMP_IF_FALSE:
+      std::cout << pre << "JUMP IF "
+                << (bc->code == meat::bytecode::JUMP_IF_TRUE ?
+                    "TRUE " : "FALSE ")
+                << local(bc->o.ji.condition) << " " << std::showpos
+                << endian::read_be(bc->o.ji.target) << " GUARD "
+                << endian::read_be(bc->o.ji.guard) << std::noshowpos << "\n";
+      ip += 6;
+      break;
+
+    case meat::bytecode::LOOP:
+      std::cout << pre << "LOOP " << local(bc->o.l.count) << " < "
+                << local(bc->o.l.limit) << " ELSE " << std::showpos
+                << endian::read_be(bc->o.l.target) << " GUARD "
+                << endian::read_be(bc->o.l.guard) << std::noshowpos << "\n";
+      ip += 7;
+      break;
+
     case meat::bytecode::ASSIGN_PROP:
     case meat::bytecode::ASSIGN_CLASS_PROP:
       std::cout << pre << local(bc->o.ap.destination) << " = ";
@@ -279,7 +331,7 @@ static void disassemble(uint8_t *ip, const std::string &pre = "    ") {
       double mantissa = ldexp(endian::read_be(bc->o.cn.mantissa), -53);
       double value = ldexp(mantissa, endian::read_be(bc->o.cn.exponent));
       std::cout << value << "\n";
-      ip += 13;
+      ip += 14;
       break;
     }
 
@@ -317,7 +369,7 @@ static void disassemble(uint8_t *ip, const std::string &pre = "    ") {
  * dump_libary *
  ***************/
 
-static void dump_libary(std::istream &in) {
+static void dump_libary(std::istream &in, std::uint8_t minor_ver) {
   in.get(); // Unused flags at the moment.
 
   // Application class index.
@@ -341,7 +393,7 @@ static void dump_libary(std::istream &in) {
   /* Import all the classes from the file. */
   unsigned int class_cnt = in.get();
   for (unsigned int cc = 0; cc < class_cnt; cc++) {
-    read_class(in);
+    read_class(in, minor_ver);
   }
 
   // Read in the symbols table.
@@ -432,6 +484,275 @@ static void dump_archive(std::istream &in) {
   std::cout << (unsigned int)index_count << " objects\n";
 }
 
+/******************************************************************************
+ * Heap snapshots
+ */
+
+#define SNAPSHOT_CLASS_ROOT   0x01
+#define SNAPSHOT_CONTEXT_ROOT 0x02
+#define SNAPSHOT_CLASS        0x04
+
+typedef struct _heap_object_s {
+  std::uint32_t class_id;
+  std::uint32_t size;
+  std::uint8_t flags;
+  std::vector<std::uint32_t> edges;
+} heap_object_t;
+
+/************
+ * read_u32 *
+ ************/
+
+static std::uint32_t read_u32(std::istream &in) {
+  std::uint32_t value = 0;
+  in.read((char *)&value, 4);
+  return endian::read_be(value);
+}
+
+/**************
+ * dominators *
+ **************/
+
+static std::vector<std::uint32_t>
+dominators(const std::vector<std::vector<std::uint32_t> > &graph,
+           std::uint32_t root, std::vector<std::uint32_t> &order) {
+  /*  Finds the immediate dominator of every node with the iterative
+   * algorithm from Cooper, Harvey and Kennedy's "A Simple, Fast Dominance
+   * Algorithm". The nodes reachable from root are put in order in postorder.
+   */
+  const std::uint32_t UNDEFINED = 0xffffffff;
+  std::size_t nodes = graph.size();
+
+  // Number the nodes in postorder with a depth first search.
+  std::vector<std::uint32_t> postorder(nodes, UNDEFINED);
+  std::vector<bool> seen(nodes, false);
+  std::vector<std::pair<std::uint32_t, std::size_t> > stack;
+  order.clear();
+  stack.push_back(std::make_pair(root, 0));
+  seen[root] = true;
+  while (not stack.empty()) {
+    std::uint32_t node = stack.back().first;
+    std::size_t &next = stack.back().second;
+    if (next < graph[node].size()) {
+      std::uint32_t succ = graph[node][next++];
+      if (not seen[succ]) {
+        seen[succ] = true;
+        stack.push_back(std::make_pair(succ, 0));
+      }
+    } else {
+      postorder[node] = order.size();
+      order.push_back(node);
+      stack.pop_back();
+    }
+  }
+
+  std::vector<std::vector<std::uint32_t> > preds(nodes);
+  for (std::uint32_t node = 0; node < nodes; ++node)
+    for (auto succ: graph[node]) preds[succ].push_back(node);
+
+  std::vector<std::uint32_t> idom(nodes, UNDEFINED);
+  idom[root] = root;
+
+  bool changed = true;
+  while (changed) {
+    changed = false;
+    for (auto node = order.rbegin(); node != order.rend(); ++node) {
+      if (*node == root) continue;
+
+      std::uint32_t new_idom = UNDEFINED;
+      for (auto pred: preds[*node]) {
+        if (idom[pred] == UNDEFINED) continue;
+        if (new_idom == UNDEFINED) {
+          new_idom = pred;
+        } else {
+          // Walk up from both until the paths meet.
+          std::uint32_t a = pred, b = new_idom;
+          while (a != b) {
+            while (postorder[a] < postorder[b]) a = idom[a];
+            while (postorder[b] < postorder[a]) b = idom[b];
+          }
+          new_idom = a;
+        }
+      }
+
+      if (idom[*node] != new_idom) {
+        idom[*node] = new_idom;
+        changed = true;
+      }
+    }
+  }
+
+  return idom;
+}
+
+/*************
+ * dump_heap *
+ *************/
+
+static void dump_heap(std::istream &in) {
+  std::map<std::uint32_t, std::string> names;
+  std::uint32_t class_cnt = read_u32(in);
+  for (std::uint32_t cc = 0; cc < class_cnt; cc++) {
+    std::uint32_t hash_id = read_u32(in);
+    std::string name;
+    char ch;
+    while ((ch = in.get()) != 0 and in)
+      name += ch;
+    names[hash_id] = name;
+  }
+
+  std::uint32_t object_cnt = read_u32(in);
+  std::vector<heap_object_t> objects(object_cnt);
+  for (auto &object: objects) {
+    object.class_id = read_u32(in);
+    object.size = read_u32(in);
+    object.flags = in.get();
+    object.edges.resize(read_u32(in));
+    for (auto &edge: object.edges) edge = read_u32(in);
+    if (not in) {
+      std::cerr << "ERROR: The heap snapshot is truncated" << std::endl;
+      return;
+    }
+  }
+
+  auto name_of = [&names](const heap_object_t &object) -> std::string {
+    auto name = names.find(object.class_id);
+    std::string result = (name != names.end() ? name->second :
+                          itohex(object.class_id));
+    if (object.flags & SNAPSHOT_CLASS) result += " class";
+    return result;
+  };
+
+  /*  All the roots hang off of a pseudo root at the end, so the dominator
+   * tree has a single root.
+   */
+  std::uint32_t root = object_cnt;
+  std::vector<std::vector<std::uint32_t> > graph(object_cnt + 1);
+  std::size_t root_cnt = 0;
+  std::size_t total = 0;
+  for (std::uint32_t c = 0; c < object_cnt; c++) {
+    for (auto edge: objects[c].edges)
+      if (edge < object_cnt) graph[c].push_back(edge);
+    if (objects[c].flags & (SNAPSHOT_CLASS_ROOT | SNAPSHOT_CONTEXT_ROOT)) {
+      graph[root].push_back(c);
+      root_cnt++;
+    }
+    total += objects[c].size;
+  }
+
+  std::vector<std::uint32_t> order;
+  std::vector<std::uint32_t> idom = dominators(graph, root, order);
+
+  /*  An object retains its own size and what everything it dominates
+   * retains. Postorder visits the dominated objects first.
+   */
+  std::vector<std::size_t> retained(object_cnt + 1, 0);
+  for (auto node: order) {
+    if (node == root) continue;
+    retained[node] += objects[node].size;
+    retained[idom[node]] += retained[node];
+  }
+
+  /*  The size a class retains is what its objects retain, not counting
+   * objects dominated by another object of the same class twice.
+   */
+  std::vector<std::vector<std::uint32_t> > tree(object_cnt + 1);
+  for (auto node: order)
+    if (node != root) tree[idom[node]].push_back(node);
+
+  typedef struct {
+    std::size_t count;
+    std::size_t shallow;
+    std::size_t retained;
+  } class_stats_t;
+  std::map<std::string, class_stats_t> classes;
+  std::map<std::string, std::size_t> active;
+  std::vector<std::pair<std::uint32_t, bool> > stack;
+  stack.push_back(std::make_pair(root, false));
+  while (not stack.empty()) {
+    std::uint32_t node = stack.back().first;
+    bool leaving = stack.back().second;
+    stack.pop_back();
+    if (node == root) {
+      for (auto child: tree[node])
+        stack.push_back(std::make_pair(child, false));
+      continue;
+    }
+
+    std::string name = name_of(objects[node]);
+    if (leaving) {
+      active[name]--;
+    } else {
+      class_stats_t &stats = classes[name];
+      stats.count++;
+      stats.shallow += objects[node].size;
+      if (active[name]++ == 0) stats.retained += retained[node];
+
+      stack.push_back(std::make_pair(node, true));
+      for (auto child: tree[node])
+        stack.push_back(std::make_pair(child, false));
+    }
+  }
+
+  std::cout << (unsigned int)object_cnt << " objects, " << total
+            << " bytes, " << root_cnt << " roots\n\n";
+
+  // The classes retaining the most first.
+  std::vector<std::pair<std::string, class_stats_t> >
+    by_class(classes.begin(), classes.end());
+  std::sort(by_class.begin(), by_class.end(),
+            [](const std::pair<std::string, class_stats_t> &a,
+               const std::pair<std::string, class_stats_t> &b) {
+              return a.second.retained > b.second.retained;
+            });
+
+  std::cout << std::left << std::setw(32) << "Class" << std::right
+            << std::setw(10) << "objects" << std::setw(12) << "shallow"
+            << std::setw(12) << "retained" << "\n";
+  for (auto &entry: by_class) {
+    std::cout << std::left << std::setw(32) << entry.first << std::right
+              << std::setw(10) << entry.second.count
+              << std::setw(12) << entry.second.shallow
+              << std::setw(12) << entry.second.retained << "\n";
+  }
+
+  // The objects retaining the most.
+  std::vector<std::uint32_t> retainers;
+  for (std::uint32_t c = 0; c < object_cnt; c++) retainers.push_back(c);
+  std::size_t shown = std::min<std::size_t>(retainers.size(), 10);
+  std::partial_sort(retainers.begin(), retainers.begin() + shown,
+                    retainers.end(),
+                    [&retained](std::uint32_t a, std::uint32_t b) {
+                      return retained[a] > retained[b];
+                    });
+
+  std::cout << "\nLargest retainers\n"
+            << std::left << std::setw(32) << "Object" << std::right
+            << std::setw(10) << "objects" << std::setw(12) << "shallow"
+            << std::setw(12) << "retained" << "\n";
+  for (std::size_t c = 0; c < shown; c++) {
+    std::uint32_t node = retainers[c];
+
+    // The number of objects the retainer dominates, itself included.
+    std::size_t dominated = 0;
+    std::vector<std::uint32_t> nodes(1, node);
+    while (not nodes.empty()) {
+      std::uint32_t next = nodes.back();
+      nodes.pop_back();
+      dominated++;
+      nodes.insert(nodes.end(), tree[next].begin(), tree[next].end());
+    }
+
+    std::stringstream name;
+    name << name_of(objects[node]) << " #" << node;
+    std::cout << std::left << std::setw(32) << name.str() << std::right
+              << std::setw(10) << dominated
+              << std::setw(12) << objects[node].size
+              << std::setw(12) << retained[node] << "\n";
+  }
+  std::cout << std::flush;
+}
+
 /**************
  * dump::dump *
  **************/
@@ -449,10 +770,14 @@ void dump::dump(const std::string &library) {
   if (strncmp(header.magic, "MLIB", 4) == 0) {
     std::cout << "Meat Library File V" << (unsigned int)header.major_ver << "."
               << (unsigned int)header.minor_ver << "\n" << std::endl;
-    dump_libary(meat_file);
+    dump_libary(meat_file, header.minor_ver);
   } else if (strncmp(header.magic, "MARC", 4) == 0) {
     std::cout << "Meat Archive File V" << (unsigned int)header.major_ver << "."
               << (unsigned int)header.minor_ver << "\n" << std::endl;
     dump_archive(meat_file);
+  } else if (strncmp(header.magic, "MHSP", 4) == 0) {
+    std::cout << "Meat Heap Snapshot V" << (unsigned int)header.major_ver
+              << "." << (unsigned int)header.minor_ver << "\n" << std::endl;
+    dump_heap(meat_file);
   }
 }
@@ -582,10 +582,11 @@ int getopt(int nargc, char * const *nargv, const char *options) {
  * getopt_long --
  *	Parse argc/argv argument vector.
  */
-int getopt_long(int nargc, char * const *nargv, const char *options,
+int getopt_long(int nargc, const char * const *nargv, const char *options,
 								const struct option *long_options, int *idx) {
 
-	return (getopt_internal(nargc, nargv, options, long_options, idx,
+	return (getopt_internal(nargc, (char * const *)nargv, options,
+	    long_options, idx,
 	    FLAG_PERMUTE));
 }
 
@@ -51,6 +51,7 @@ static void help() {
   std::cout << "  -c appclass  Compile a library\n";
   std::cout << "  -s           Run the source as an intrepreted script\n";
   std::cout << "  -# text      Return a hash value for the text\n";
+  std::cout << "  -d file      Dump a library, archive or heap snapshot\n";
 	std::cout << "  -V           Version information\n";
   std::cout << "  -h           Displays this help" << std::endl;
 }
@@ -25,6 +25,13 @@
 
 #include <iostream>
 #include <exception>
+#include <cstring>
+#include <cstdlib>
+#include <cctype>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <iomanip>
 
 #ifdef TESTING
 #include <testing.h>
@@ -36,11 +43,21 @@
 
 static void help() {
   std::cout << "Meat v" << VERSION << "\n\n"
-            << "meat [-i path] archive ...\n"
+            << "meat [-i path] [--jit] [--gc-option=value] archive ...\n"
             << "meatc -h\n"
             << "  -i path      Include path to the library search\n"
-            << "  -V           Display the version\n"
-            << "  -h           Displays this help"
+            << "  --jit        Compile frequently used methods to native code\n"
+            << "  --jit-threshold=count    Sends before a method is compiled\n"
+            << "  --memstats   Display memory statistics on exit\n"
+            << "  --heap-snapshot=file     Write a heap snapshot on exit\n"
+            << "  --gc-limit=bytes         Most bytes of empty slabs to keep\n"
+            << "  --gc-age=seconds         How long to keep empty slabs\n"
+            << "  --gc-interval=count      Allocations between collections\n"
+            << "  --gc-budget=count        Most slabs given back per collection\n"
+            << "  --cycle-threshold=count  Possible cycle roots to collect at\n"
+            << "  --cycle-budget=count     Most cycle roots per collection\n"
+            << "  -V, --version            Display the version\n"
+            << "  -h, --help               Displays this help"
             << std::endl;
 }
 
@@ -59,6 +76,124 @@ static void version() {
             << std::endl;
 }
 
+/****************
+ * long_options *
+ ****************/
+
+enum {
+  OPT_JIT = 256,
+  OPT_JIT_THRESHOLD,
+  OPT_MEMSTATS,
+  OPT_HEAP_SNAPSHOT,
+  OPT_GC_LIMIT,
+  OPT_GC_AGE,
+  OPT_GC_INTERVAL,
+  OPT_GC_BUDGET,
+  OPT_CYCLE_THRESHOLD,
+  OPT_CYCLE_BUDGET
+};
+
+static const struct option long_options[] = {
+  {"jit",             no_argument,       NULL, OPT_JIT},
+  {"jit-threshold",   required_argument, NULL, OPT_JIT_THRESHOLD},
+  {"memstats",        no_argument,       NULL, OPT_MEMSTATS},
+  {"heap-snapshot",   required_argument, NULL, OPT_HEAP_SNAPSHOT},
+  {"gc-limit",        required_argument, NULL, OPT_GC_LIMIT},
+  {"gc-age",          required_argument, NULL, OPT_GC_AGE},
+  {"gc-interval",     required_argument, NULL, OPT_GC_INTERVAL},
+  {"gc-budget",       required_argument, NULL, OPT_GC_BUDGET},
+  {"cycle-threshold", required_argument, NULL, OPT_CYCLE_THRESHOLD},
+  {"cycle-budget",    required_argument, NULL, OPT_CYCLE_BUDGET},
+  {"help",            no_argument,       NULL, 'h'},
+  {"version",         no_argument,       NULL, 'V'},
+  {NULL,              0,                 NULL, 0}
+};
+
+/**********
+ * number *
+ **********/
+
+static bool number(const char *value, unsigned long &result) {
+  if (not std::isdigit(value[0])) return false;
+
+  char *end;
+  result = std::strtoul(value, &end, 10);
+  return *end == '\0';
+}
+
+/*************
+ * gc_option *
+ *************/
+
+static bool gc_option(int option, const char *value) {
+  /* Garbage collector options are all numbers, where zero usually means
+   * no limit.
+   */
+  unsigned long count;
+  if (not number(value, count)) return false;
+
+  switch (option) {
+  case OPT_GC_LIMIT: memory::gc::limit = count; break;
+  case OPT_GC_AGE: memory::gc::collection_age = count; break;
+  case OPT_GC_INTERVAL: memory::gc::collection_interval = count; break;
+  case OPT_GC_BUDGET: memory::gc::collection_budget = count; break;
+  case OPT_CYCLE_THRESHOLD: memory::gc::cycle_threshold = count; break;
+  case OPT_CYCLE_BUDGET: memory::gc::cycle_budget = count; break;
+  default: return false;
+  }
+  return true;
+}
+
+/************
+ * memstats *
+ ************/
+
+static void memstats() {
+  memory::gc::stats_t heap = memory::gc::stats();
+  memory::gc::cycle_stats_t cycles = memory::gc::cycle_stats();
+
+  std::cerr << "Memory statistics:\n"
+            << "  allocations       " << heap.allocations << " ("
+            << (heap.allocations ? heap.reused * 100 / heap.allocations : 0)
+            << "% reused blocks)\n"
+            << "  recycled          " << heap.recycled << "\n"
+            << "  allocated bytes   " << heap.bytes << " (peak "
+            << heap.peak_bytes << ")\n"
+            << "  large objects     " << heap.large_objects << "\n"
+            << "  slabs             " << heap.slabs << " ("
+            << heap.slab_bytes << " bytes, " << heap.empty_bytes
+            << " empty)\n"
+            << "  cycle collections " << cycles.collections << " ("
+            << cycles.examined << " roots, " << cycles.garbage
+            << " garbage)\n";
+
+  // The classes with the most live instances first.
+  std::vector<meat::Class *> classes;
+  for (auto entry = meat::Class::begin(); entry != meat::Class::end();
+       ++entry) {
+    meat::Class &cls = meat::cast<meat::Class>(entry->second);
+    if (cls.instances().created) classes.push_back(&cls);
+  }
+  std::sort(classes.begin(), classes.end(),
+            [](meat::Class *a, meat::Class *b) {
+              if (a->instances().live != b->instances().live)
+                return a->instances().live > b->instances().live;
+              return a->instances().peak > b->instances().peak;
+            });
+
+  std::cerr << "  " << std::left << std::setw(24) << "class" << std::right
+            << std::setw(10) << "live" << std::setw(11) << "peak"
+            << std::setw(11) << "created" << "\n";
+  for (auto cls: classes) {
+    const meat::Class::instance_stats_t &instances = cls->instances();
+    std::cerr << "  " << std::left << std::setw(24) << cls->name()
+              << std::right << std::setw(10) << instances.live
+              << std::setw(11) << instances.peak
+              << std::setw(11) << instances.created << "\n";
+  }
+  std::cerr << std::flush;
+}
+
 /******************************************************************************
  * Here's where is all starts.
  */
@@ -73,6 +208,8 @@ int main(int argc, const char *argv[]) {
 #endif
 
   const char *filename = NULL;
+  bool show_memstats = false;
+  std::string snapshot;
 
   meat::initialize(argc, argv); // Initialize the runtime environment.
 
@@ -80,11 +217,46 @@ int main(int argc, const char *argv[]) {
    * Parse the command line options.
    */
   int opt;
-  while ((opt = getopt(argc, argv, "i:hV")) != -1) {
+  int index;
+  while ((opt = getopt_long(argc, argv, "+i:hV", long_options,
+                            &index)) != -1) {
     switch (opt) {
     case 'i':
       meat::data::Library::add_path(optarg);
       break;
+    case OPT_JIT:
+      if (not meat::enable_jit())
+        std::cerr << "WARNING: the JIT isn't available on this platform"
+                  << std::endl;
+      break;
+    case OPT_JIT_THRESHOLD: {
+      unsigned long count;
+      if (not number(optarg, count) or count == 0) {
+        std::cerr << "FATAL: bad option --jit-threshold=" << optarg
+                  << std::endl;
+        return 1;
+      }
+      meat::jit_threshold(count);
+      break;
+    }
+    case OPT_MEMSTATS:
+      show_memstats = true;
+      break;
+    case OPT_HEAP_SNAPSHOT:
+      snapshot = optarg;
+      break;
+    case OPT_GC_LIMIT:
+    case OPT_GC_AGE:
+    case OPT_GC_INTERVAL:
+    case OPT_GC_BUDGET:
+    case OPT_CYCLE_THRESHOLD:
+    case OPT_CYCLE_BUDGET:
+      if (not gc_option(opt, optarg)) {
+        std::cerr << "FATAL: bad option --" << long_options[index].name
+                  << "=" << optarg << std::endl;
+        return 1;
+      }
+      break;
     case 'h': // Help option
       help();
 #ifdef TESTING
@@ -144,6 +316,9 @@ int main(int argc, const char *argv[]) {
       return 1;
     }
 
+    if (show_memstats) memstats();
+    if (not snapshot.empty()) meat::data::heap_snapshot(snapshot);
+
     /*  Attempt to return the return value from the entry method. If the
      * value return from entry is not an integer then we return 1 (error).
      * If no value was returned then we return 0 (success).
@@ -164,6 +339,7 @@ int main(int argc, const char *argv[]) {
   } catch (std::exception &err) {
     /* Opps an uncaught exception. */
     std::cerr << "UNCAUGHT EXCEPTION: " << err.what() << std::endl;
+    if (show_memstats) memstats();
 
 #ifdef TESTING
     meat::test::summary();
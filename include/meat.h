@@ -27,6 +27,8 @@
 #include <set>
 #include <string>
 #include <stdexcept>
+#include <typeinfo>
+#include <type_traits>
 #include <vector>
 #include <deque>
 #include <iostream>
@@ -57,17 +59,47 @@ namespace meat {
   class DECLSPEC Context;
   class DECLSPEC BlockContext;
   class DECLSPEC Exception;
+  class DECLSPEC Value;
+  class DECLSPEC Text;
+  class DECLSPEC List;
+  class DECLSPEC Set;
+  class DECLSPEC Index;
+  class DECLSPEC InlineCache;
   namespace data { // Found in datastore.h
     class Library;
     class Archive;
   }
+  namespace bytecode { // Found in meat/bytecode.h
+    typedef struct _instruction_s instruction_t;
+  }
 
   /** A reference counter pointer to Script Objects and classes.
    */
   typedef memory::reference<Object> Reference;
 
-  template <class Ty>
-  Ty &cast(Reference object) { return dynamic_cast<Ty &>(*(object)); }
+  /** The native kind of an Object. Every core Object class tags itself
+   * with its kind when constructed so cast() can check the type of an
+   * Object without going through the C++ RTTI. Objects of any other native
+   * class are tagged KIND_OBJECT.
+   * @see cast()
+   */
+  typedef enum {
+    KIND_OBJECT       = 0x00,
+    KIND_CLASS        = 0x01,
+    KIND_CONTEXT      = 0x02,
+    KIND_BLOCKCONTEXT = 0x03,
+    KIND_EXCEPTION    = 0x04,
+    KIND_VALUE        = 0x05,
+    KIND_TEXT         = 0x06,
+    KIND_LIST         = 0x07,
+    KIND_SET          = 0x08,
+    KIND_INDEX        = 0x09
+  } kind_t;
+
+  /** Casts a Reference to the native class of the Object.
+   * @exception std::bad_cast If the Object isn't of the native class.
+   */
+  template <class Ty> Ty &cast(const Reference &object);
 
   /** Initializes the Meat virutal machine.
    */
@@ -80,13 +112,15 @@ namespace meat {
    * @param Object The Object to send the message to.
    * @param hash_id The hashed id of the method name.
    * @param context The calling context.
+   * @param cache An optional inline cache for the sending bytecode.
    * @return A new context to be executed by meat::execute().
    * @see meat::execute()
    * @see hash()
    */
   Reference DECLSPEC message(Reference object,
                              std::uint32_t hash_id,
-                             Reference context);
+                             Reference context,
+                             InlineCache *cache = nullptr);
 
   Reference DECLSPEC message(Reference object,
                              const std::string &method,
@@ -94,9 +128,36 @@ namespace meat {
 
   Reference DECLSPEC message_super(Reference object,
                                    std::uint32_t hash_id,
-                                   Reference context);
+                                   Reference context,
+                                   InlineCache *cache = nullptr);
   //@}
 
+  /** Statistics for the global method lookup cache.
+   */
+  typedef struct _lookup_stats_s {
+    std::uint64_t hits;
+    std::uint64_t misses;
+  } lookup_stats_t;
+
+  /** Returns the hit and miss counts of the global method lookup cache.
+   * @see meat::message()
+   */
+  lookup_stats_t DECLSPEC lookup_stats();
+
+  /** Enables the template JIT, bytecode methods that are sent often are
+   * then compiled to native code. The JIT is only available on x86-64, on
+   * other platforms everything stays with the interpreter.
+   * @param enable Set to false to stop compiling any more methods.
+   * @return True if the JIT is available.
+   */
+  bool DECLSPEC enable_jit(bool enable = true);
+
+  /** Sets how many times a bytecode method is sent before the JIT compiles
+   * it, a count of 1 compiles every method the first time it's sent.
+   * @param count The number of sends.
+   */
+  void DECLSPEC jit_threshold(std::uint32_t count);
+
   /** Executes a context that has been created by meat::message().
    * @param context The context created by message.
    * @return The results of the message.
@@ -110,7 +171,7 @@ namespace meat {
 
   /** Base Object class for all objects within the virtual machine.
    */
-  class DECLSPEC Object : public memory::recyclable {
+  class DECLSPEC Object : public memory::collectable {
   public:
     /** Creates a new Object of the given class type.
      * @param type A Reference to the class for the new Object.
@@ -125,6 +186,16 @@ namespace meat {
      */
     virtual ~Object () throw ();
 
+    using memory::collectable::operator new;
+    using memory::collectable::operator delete;
+
+    /** Allocates an Object with room for its properties after it. An Object
+     * created with new (properties) keeps its properties in that room
+     * rather than allocating them separately.
+     */
+    void *operator new(std::size_t size, std::uint8_t properties);
+    void operator delete(void *ptr, std::uint8_t properties) noexcept;
+
     /** Returns a reference to the class type for the Object.
      */
     Reference type() const { return _type; };
@@ -138,6 +209,10 @@ namespace meat {
 
     virtual bool is_object() const { return true; };
 
+    /** Returns the native kind of the Object.
+     */
+    kind_t kind() const { return (kind_t)_kind; }
+
     /** Serialize the Object data to a data store.
      * @param store The store where Object is getting serialized to. This is
      *              given to the serialize method for the purpose of added
@@ -158,14 +233,44 @@ namespace meat {
      * @return Return the number of properties.
      */
     std::uint8_t properties() const { return _properties; }
-    virtual Reference &property(std::uint8_t index);
-    virtual const Reference &property(std::uint8_t index) const;
+
+    /** Returns one of the Object's properties.
+     * @exception Exception If the index is out of range.
+     */
+    Reference &property(std::uint8_t index) {
+      if (index >= _properties) bad_property(index);
+      return _property[index];
+    }
+
+    const Reference &property(std::uint8_t index) const {
+      if (index >= _properties) bad_property(index);
+      return _property[index];
+    }
+
+    /** Visits the Object's properties for the cycle collector.
+     */
+    virtual void trace(tracer &visit);
+
+    /** Sets all the Object's properties to Null.
+     */
+    virtual void unlink();
 
     friend void initialize(int argc, const char *argv[]);
 
+  protected:
+    /** Sets the native kind of the Object, only the core Object classes
+     * should need to do this.
+     */
+    void kind(kind_t value) { _kind = value; }
+
   private:
+    void init_properties();
+    void bad_property(std::uint8_t index) const;
+
     meat::Reference _type;
     std::uint8_t _properties;
+    std::uint8_t _kind;
+    bool _trailing;              // The properties follow the Object.
     meat::Reference *_property;
   };
 
@@ -199,6 +304,7 @@ namespace meat {
       meat::method_ptr_t pointer;
       std::uint16_t offset;
     } method;
+    mutable std::uint32_t invocations; // Bytecode method calls, for the JIT
   } vtable_entry_t;
 
   typedef struct _symbol_entry_s {
@@ -208,6 +314,74 @@ namespace meat {
 
   typedef enum {STATIC, DYNAMIC, COPY} alloc_t;
 
+  /** The core classes that are cached by the virtual machine.
+   * @see Class::core()
+   */
+  typedef enum {
+    CORE_OBJECT, CORE_CLASS, CORE_CONTEXT, CORE_BLOCKCONTEXT, CORE_NULL,
+    CORE_EXCEPTION, CORE_BOOLEAN, CORE_BLOCKPARAMETER, CORE_INTEGER,
+    CORE_NUMBER, CORE_TEXT, CORE_LIST, CORE_SET, CORE_INDEX, CORE_LIBRARY,
+    CORE_ARCHIVE,
+    CORE_CLASSES // The number of core classes.
+  } core_class_t;
+
+  /** A method cache for a single message send in the bytecode. Each entry
+   * maps the class of a receiver to the resolved vtable entry and the class
+   * that defines the method. Most send sites only ever see one class
+   * (monomorphic) but up to ENTRIES classes are cached (polymorphic). Once a
+   * site has seen more classes than that it's considered megamorphic and is
+   * no longer cached.
+   *
+   *  All the caches are invalidated together with flush() whenever the class
+   * hierarchy changes.
+   */
+  class DECLSPEC InlineCache {
+  public:
+    static const unsigned int ENTRIES = 4;
+
+    InlineCache();
+
+    /** Find the cached method entry for the receiver's class.
+     * @param receiver The class of the object being messaged.
+     * @param is_class True if the message is sent to a class object.
+     * @param klass Set to the class that defines the method.
+     * @return The method entry or nullptr if the method isn't cached.
+     */
+    const vtable_entry_t *find(Reference &receiver, bool is_class,
+                               Reference &klass);
+
+    /** Add a resolved method to the cache.
+     */
+    void add(Reference &receiver, bool is_class,
+             const vtable_entry_t *m_entry, Reference &klass);
+
+    bool is_megamorphic() const { return megamorphic; }
+
+    /** Invalidates every inline cache along with the global method lookup
+     * cache.
+     */
+    static void flush();
+
+    /** The current cache epoch. Quickened instructions are only valid in
+     * the epoch they were quickened in.
+     */
+    static const std::uint32_t &current();
+
+  private:
+    void clear();
+
+    std::uint32_t epoch;
+    std::uint8_t used;
+    bool megamorphic;
+
+    struct {
+      Reference receiver;   // Weak reference to the receiver's class.
+      bool is_class;
+      const vtable_entry_t *m_entry;
+      Reference klass;      // Weak reference to the defining class.
+    } entries[ENTRIES];
+  };
+
   /**
    */
   class DECLSPEC Class : public Object {
@@ -224,6 +398,17 @@ namespace meat {
 
     virtual ~Class() throw ();
 
+    /** Counts of a class's instances, not including the instances of its
+     * subclasses.
+     */
+    typedef struct _instance_stats_s {
+      std::size_t live;    // Instances that haven't been destroyed.
+      std::size_t peak;    // The most instances live at once.
+      std::size_t created;
+    } instance_stats_t;
+
+    const instance_stats_t &instances() const { return _instances; }
+
     /** Get the meat super class for this class.
      * @return A Reference to the class's super class.
      */
@@ -260,22 +445,28 @@ namespace meat {
      * @see new_object()
      */
     void set_constructor(constructor_t constructor);
-    void set_vtable(std::uint8_t entries, vtable_entry_t table[],
+    void set_vtable(std::uint16_t entries, vtable_entry_t table[],
                     alloc_t table_alloc);
-    void set_class_vtable(std::uint8_t entries, vtable_entry_t table[],
+    void set_class_vtable(std::uint16_t entries, vtable_entry_t table[],
                           alloc_t table_alloc);
 
     void bytecode(std::uint16_t size, std::uint8_t *code, alloc_t code_alloc);
     const std::uint8_t *bytecode() const;
 
-    const vtable_entry_t *get_vtable(uint8_t &count) const;
-    const vtable_entry_t *get_class_vtable(uint8_t &count) const;
+    const vtable_entry_t *get_vtable(std::uint16_t &count) const;
+    const vtable_entry_t *get_class_vtable(std::uint16_t &count) const;
 
     virtual void serialize(data::Archive &store,
                            std::ostream &data_stream) const;
 
     virtual void write(std::ostream &lib_file) const;
-    static Class *import(std::istream &lib_file);
+
+    /** Reads a class written by write() from a library file.
+     * @param lib_file The library file to read the class from.
+     * @param minor_ver The minor version of the library file format, 1.0
+     *                  libraries only have 8bit virtual table sizes.
+     */
+    static Class *import(std::istream &lib_file, std::uint8_t minor_ver = 1);
 
     /** Lookup the symbol for the given hash_id. If there's no symbol for the
      * hash_id then the hash_id is returned as a hexidecimal string.
@@ -316,6 +507,14 @@ namespace meat {
      */
     static Reference &resolve(std::uint32_t hash_id, bool compiled = true);
 
+    /** Resolves one of the core classes. The core classes are cached as
+     * they are recorded so this avoids hashing and searching for the class
+     * name.
+     * @param cls The core class to resolve.
+     * @exception Exception If the class hasn't been recorded yet.
+     */
+    static Reference &core(core_class_t cls);
+
     /**
      */
     static bool have_class(const std::string &id);
@@ -337,12 +536,18 @@ namespace meat {
     friend void initialize(int argc, const char *argv[]);
     friend Reference message(Reference object,
                              std::uint32_t hash_id,
-                             Reference context);
+                             Reference context,
+                             InlineCache *cache);
     friend Reference message_super(Reference object,
                                    std::uint32_t hash_id,
-                                   Reference context);
+                                   Reference context,
+                                   InlineCache *cache);
+    friend bool message_tail(Reference &context,
+                             const bytecode::instruction_t *in);
     friend Reference execute(Reference context);
     friend class data::Library;
+    friend class JIT;
+    friend class Object;
 
   private:
     /** The virtual method table for class Objects.
@@ -352,13 +557,29 @@ namespace meat {
         VTable();
         virtual ~VTable() throw();
 
-        void set_vtable(std::uint8_t entries, vtable_entry_t table[],
+        void set_vtable(std::uint16_t entries, vtable_entry_t table[],
                         alloc_t table_alloc);
-        void set_class_vtable(std::uint8_t entries, vtable_entry_t table[],
+        void set_class_vtable(std::uint16_t entries, vtable_entry_t table[],
                               alloc_t table_alloc);
         void set(constructor_t constructor_func);
 
-        void link(Class &super);
+        /** Resolves the inherited entries from the super class of cls and
+         * builds the flattened dispatch tables.
+         */
+        void link(const Class &cls);
+
+        /** Builds the flattened dispatch tables for the class cls. The
+         * tables hold every method the class responds to, including all the
+         * inherited methods, so a message never has to search through the
+         * super classes.
+         */
+        void flatten(const Class &cls) const;
+
+        /** Returns the method entry from the flattened dispatch tables,
+         * the tables must have been flattened in the current cache epoch.
+         */
+        const vtable_entry_t *dispatch(std::uint32_t hash_id,
+                                       bool class_method) const;
 
         /** Returns the virtual table entry if the method was found.
          */
@@ -368,32 +589,86 @@ namespace meat {
         const vtable_entry_t *class_find(std::uint32_t hash_id) const;
 
         void write(std::ostream &lib_file) const;
-        void read(std::istream &lib_file);
+        void read(std::istream &lib_file, bool wide_sizes = true);
 
         friend class Class;
-        friend Reference message(Reference object,
-                                 std::uint32_t hash_id,
-                                 Reference context);
-        friend Reference message_super(Reference object,
-                                       std::uint32_t hash_id,
-                                       Reference context);
       private:
+        /** A cuckoo hash of method entries on their hash ids. Every entry is
+         * in one of two slots, so a lookup never probes more than twice.
+         */
+        typedef struct _dispatch_s {
+          std::uint32_t mult[2];  // Multipliers for the two slot hashes.
+          std::uint8_t shift;
+          std::vector<const vtable_entry_t *> slots;
+        } dispatch_t;
+
+        /** Places every method in the table, trying new hashes and growing
+         * the table until they all fit.
+         */
+        static void build(dispatch_t &table,
+                          const std::vector<const vtable_entry_t *> &methods);
+
         // Object virtual table entries
-        std::uint8_t no_entries;
+        std::uint16_t no_entries;
         vtable_entry_t *entries;
         bool e_is_static;
 
         // Class virtual table entries.
-        std::uint8_t no_centries;
+        std::uint16_t no_centries;
         vtable_entry_t *centries;
         bool ce_is_static;
 
         constructor_t constructor;
+
+        // The flattened dispatch tables and the cache epoch they were built
+        // in, they are rebuilt when the class hierarchy changes.
+        mutable std::uint32_t d_epoch;
+        mutable dispatch_t d_entries;
+        mutable dispatch_t d_centries;
     };
 
     const vtable_entry_t *find(std::uint32_t hash_id) const;
     const vtable_entry_t *class_find(std::uint32_t hash_id) const;
 
+    /** Find a method entry searching through the super classes.
+     * @param hash_id The hashed id of the method name.
+     * @param class_method True to search the class method tables.
+     * @return The method entry or nullptr if the method wasn't found.
+     */
+    const vtable_entry_t *find_method(std::uint32_t hash_id,
+                                      bool class_method) const;
+
+    /** Predecode the bytecode into the native instruction array that the
+     * interpreter executes. The bytecode itself is left untouched so it can
+     * still be written out to a library.
+     */
+    void predecode();
+
+    /** Get the instruction index for an offset into the bytecode.
+     * @param offset The byte offset of an instruction, such as a method's
+     *               entry point.
+     * @return The index into the instruction array.
+     */
+    std::uint16_t entry(std::uint16_t offset) const;
+
+    /** Get the pooled literal object for the ASSIGN_CONST_* instruction at
+     * index. The literal is created the first time it's needed and then
+     * shared by every execution of the instruction.
+     */
+    const Reference &constant(std::uint16_t index);
+
+    /** Rewrite the instruction at index into a quickened form, once the
+     * generic instruction has been run in context.
+     */
+    void quicken(std::uint16_t index, Reference &context);
+
+    // Counts a new instance of the class.
+    void created() {
+      _instances.created++;
+      if (++_instances.live > _instances.peak)
+        _instances.peak = _instances.live;
+    }
+
     std::string _name;
     std::uint32_t _hash_id;
     Reference _super;
@@ -405,6 +680,17 @@ namespace meat {
     std::uint16_t _bytecode_size;
     std::uint8_t *_bytecode;
     bool _bytecode_static;
+
+    // The predecoded bytecode with its send site caches and constant pool.
+    bytecode::instruction_t *_program;
+    std::uint16_t *_entry_index;
+    std::deque<InlineCache> _caches;
+    std::vector<Reference> _constants;
+
+    // Native code for each instruction, once the JIT has compiled it.
+    void **_native;
+
+    instance_stats_t _instances;
   };
 
   /****************************************************************************
@@ -432,10 +718,25 @@ namespace meat {
      * @locals The number of local variables to allocate.
      */
     explicit Context(std::uint8_t locals);
-    Context(Reference context, std::uint8_t locals);
+
+    /** Create a new context for a message.
+     * @param context The calling context.
+     * @param locals The number of local variables to allocate.
+     * @param stack_frame If true the local variables are allocated from the
+     *        context frame stack instead of the heap.
+     * @see promote()
+     */
+    Context(Reference context, std::uint8_t locals, bool stack_frame = false);
     Context(Reference cls, Reference context, std::uint8_t locals);
     virtual ~Context() throw();
 
+    /** Moves the local variables from the context frame stack to the heap.
+     * This must be called whenever the context is captured and may outlive
+     * the message that created it, like by a BlockContext, an Exception or
+     * when the context itself is stored in a variable.
+     */
+    void promote();
+
     virtual Reference self() const;
     virtual void self(Reference new_self);
 
@@ -469,7 +770,7 @@ namespace meat {
     virtual uint8_t locals() const { return num_of_locals; };
 
     uint16_t ip() const { return _ip; };
-    void ip(uint16_t offset) { _ip = offset; };
+    void ip(uint16_t index) { _ip = index; };
 
     void result_index(uint8_t local_parent_index);
     void result(Reference value);
@@ -480,17 +781,61 @@ namespace meat {
     virtual void unfinish() { done = false; };
     virtual void reset() {};
 
+    /** Calls the primitive of the context.
+     * @see invoke()
+     */
     virtual Reference operator ()(Reference context);
 
+    /** Lets a primitive run a block without nesting another interpreter
+     * with meat::execute(). The primitive returns the result of invoke()
+     * straight away, the interpreter then runs the block in its place and
+     * calls the primitive again once the block is done. The primitive uses
+     * step() to tell how far along it is.
+     * @param block The BlockContext to run.
+     * @param catches If true, an exception raised while the block runs
+     *        ends the block and the primitive is called again with the
+     *        exception in caught().
+     * @return The block, which the primitive must return.
+     * @code
+     * if (cast<Context>(context).step() < 10)
+     *   return cast<Context>(context).invoke(block);
+     * return null;
+     * @endcode
+     */
+    Reference invoke(Reference block, bool catches = false);
+
+    /** Returns true while the primitive is waiting on a block it invoked.
+     */
+    bool invoking() const { return (_invoke & INVOKE_WAITING); };
+
+    /** The number of blocks the primitive has invoked so far, so 0 the first
+     * time it's called.
+     */
+    std::uint32_t step() const { return _steps; };
+
+    /** The exception that ended the last block the primitive invoked, or
+     * Null if the block wasn't ended by an exception.
+     */
+    Reference caught() const;
+
+    virtual void trace(tracer &visit);
+    virtual void unlink();
+
     friend class Class;
     friend class BlockContext;
     friend Reference message(Reference object,
                              uint32_t hash_id,
-                             Reference context);
+                             Reference context,
+                             InlineCache *cache);
     friend Reference message_super(Reference object,
                                    uint32_t hash_id,
-                                   Reference context);
+                                   Reference context,
+                                   InlineCache *cache);
+    friend bool message_tail(Reference &context,
+                             const bytecode::instruction_t *in);
+    friend bool catch_exception(Reference &context);
     friend Reference execute(Reference context);
+    friend class JIT;
 
   protected:
     /** The context that this context was created in. If this is Null then
@@ -515,6 +860,16 @@ namespace meat {
     uint8_t _result_index;
 
     bool done;
+    bool _on_stack; // The locals are on the context frame stack.
+
+    typedef enum {
+      INVOKE_WAITING = 0x01, // Waiting on the invoked block
+      INVOKE_CATCHES = 0x02, // Catching exceptions from the invoked block
+      INVOKE_CAUGHT  = 0x04  // The result is the exception caught
+    } invoke_t;
+
+    uint8_t _invoke;
+    std::uint32_t _steps;
   };
 
   /****************************************************************************
@@ -533,7 +888,7 @@ namespace meat {
     }
 
     virtual void self(Reference new_self) {
-      cast<Context>(_origin).self(new_self);
+      cast<Context>(_origin).self(std::move(new_self));
     }
 
     virtual Reference klass() const {
@@ -551,7 +906,7 @@ namespace meat {
     };
 
     virtual void parameter(uint8_t index, Reference value) {
-      _locals[index] = value;
+      _locals[index] = std::move(value);
     };
 
     /** Set a local variable with the given value. The index for the local
@@ -571,6 +926,10 @@ namespace meat {
 
     Reference origin() const { return _origin; }
 
+    /** The instruction index the block's code starts at.
+     */
+    uint16_t start() const { return start_ip; }
+
     void c_break();
     void c_continue();
     void set_break_trap();
@@ -581,6 +940,9 @@ namespace meat {
     bool continue_called() const;
     virtual void reset();
 
+    virtual void trace(tracer &visit);
+    virtual void unlink();
+
   private:
     Reference _origin;
     uint8_t bc_flags;
@@ -649,8 +1011,8 @@ namespace meat {
     } data;
   };
 
-#define INTEGER(ref) ((std::int32_t)(dynamic_cast<meat::Value &>(*(ref))))
-#define FLOAT(ref) ((double)(dynamic_cast<meat::Value &>(*(ref))))
+#define INTEGER(ref) (meat::integer_value(ref))
+#define FLOAT(ref) (meat::float_value(ref))
 
   /****************************************************************************
    */
@@ -701,6 +1063,9 @@ namespace meat {
     virtual void serialize(data::Archive &store,
                            std::ostream &data_stream) const;
     virtual void unserialize(data::Archive &store, std::istream &data_stream);
+
+    virtual void trace(tracer &visit);
+    virtual void unlink();
   };
 
   /****************************************************************************
@@ -735,6 +1100,9 @@ namespace meat {
                            std::ostream &data_stream) const;
     virtual void unserialize(data::Archive &store, std::istream &data_stream);
 
+    virtual void trace(tracer &visit);
+    virtual void unlink();
+
     void swap(Set &other) {
       std::set<Reference, obj_less>::swap(other);
     }
@@ -766,6 +1134,9 @@ namespace meat {
     virtual void serialize(data::Archive &store,
                            std::ostream &data_stream) const;
     virtual void unserialize(data::Archive &store, std::istream &data_stream);
+
+    virtual void trace(tracer &visit);
+    virtual void unlink();
   };
 
   class DECLSPEC CompilerInterface {
@@ -780,6 +1151,65 @@ namespace meat {
     virtual void set_application_class(meat::Reference klass) = 0;
   };
 
+  /****************************************************************************
+   * Object kinds
+   */
+
+  /** Maps a native class to the Object kinds it can be cast from. Classes
+   * that aren't tagged fall back to dynamic_cast.
+   */
+  template <class Ty> struct kind_of : std::false_type {
+    static bool accepts(kind_t) { return false; }
+  };
+
+#define KIND_OF(cls, test) \
+  template <> struct kind_of<cls> : std::true_type { \
+    static bool accepts(kind_t kind) { (void)kind; return (test); } \
+  }
+
+  KIND_OF(Object, true);
+  KIND_OF(Class, kind == KIND_CLASS);
+  KIND_OF(Context, kind == KIND_CONTEXT or kind == KIND_BLOCKCONTEXT);
+  KIND_OF(BlockContext, kind == KIND_BLOCKCONTEXT);
+  KIND_OF(Exception, kind == KIND_EXCEPTION);
+  KIND_OF(Value, kind == KIND_VALUE);
+  KIND_OF(Text, kind == KIND_TEXT);
+  KIND_OF(List, kind == KIND_LIST);
+  KIND_OF(Set, kind == KIND_SET);
+  KIND_OF(Index, kind == KIND_INDEX);
+
+#undef KIND_OF
+
+  //@{
+  /** Casts with the Object's kind tag if the class is tagged. Debug builds
+   * still use dynamic_cast and make sure the tag agrees with it.
+   */
+  template <class Ty>
+  Ty &cast(Object &obj, std::true_type) {
+    typedef typename std::remove_const<Ty>::type base_t;
+#ifdef DEBUG
+    Ty &result = dynamic_cast<Ty &>(obj);
+    if (not kind_of<base_t>::accepts(obj.kind()))
+      throw std::logic_error("Object kind tag doesn't match its class");
+    return result;
+#else
+    if (not kind_of<base_t>::accepts(obj.kind())) throw std::bad_cast();
+    return static_cast<Ty &>(obj);
+#endif
+  }
+
+  template <class Ty>
+  Ty &cast(Object &obj, std::false_type) { return dynamic_cast<Ty &>(obj); }
+
+  template <class Ty>
+  Ty &cast(const Reference &object) {
+    typedef typename std::remove_const<Ty>::type base_t;
+    if (object.is_immediate()) throw std::bad_cast();
+    // Only the handle is const here, not the Object it references.
+    return cast<Ty>(const_cast<Object &>(*object), kind_of<base_t>());
+  }
+  //@}
+
   void DECLSPEC compiler(CompilerInterface *impl);
   CompilerInterface DECLSPEC *compiler();
 
@@ -789,6 +1219,53 @@ namespace meat {
 
   Reference DECLSPEC Null();
 
+  /** Get an Integer object for a value. Integers are held in the Reference
+   * itself as an immediate value, so they never need to be allocated. Only
+   * where a pointer is too small for the value is it boxed in a new Value.
+   */
+  inline Reference Integer(std::int32_t value) {
+    if (Reference::fits_immediate(value))
+      return Reference::immediate(value);
+    return new Value(value);
+  }
+
+  //@{
+  /** Get the native value of an Integer or Number, whether it's an
+   * immediate Integer or a Value object. Use the INTEGER() and FLOAT()
+   * macros rather than calling these directly.
+   * @exception std::bad_cast If the Object isn't a Value.
+   */
+  inline std::int32_t integer_value(const Reference &object) {
+    if (object.is_immediate()) return (std::int32_t)object.immediate();
+    return (std::int32_t)cast<Value>(object);
+  }
+
+  inline double float_value(const Reference &object) {
+    if (object.is_immediate()) return (double)object.immediate();
+    return (double)cast<Value>(object);
+  }
+  //@}
+
+  /** Returns the class of an Object. Immediate Integers aren't Objects, so
+   * anything that might be handed one should use this instead of
+   * Object::type().
+   */
+  inline Reference type_of(const Reference &object) {
+    if (object.is_immediate()) return Class::core(CORE_INTEGER);
+    return object->type();
+  }
+
+  /** Tests if an Object, or an immediate Integer, is of type class.
+   * @see Object::is_type()
+   */
+  bool DECLSPEC is_type(const Reference &object, Reference cls);
+
+  /** Tests if an Object is a Class, immediate Integers never are.
+   */
+  inline bool is_class(const Reference &object) {
+    return (not object.is_immediate() and object->is_class());
+  }
+
 }
 
 #endif /* _MEAT_H */
@@ -20,6 +20,7 @@
 
 /** @file */
 
+#include <meat.h>
 #include <meat/numeric.h>
 
 #ifndef _MEAT_BYTECODE_H
@@ -37,9 +38,30 @@ namespace meat {
     const std::uint8_t MESG_SUPER         = 0x03;
     const std::uint8_t MESG_SUPER_RESULT  = 0x04;
 
+    /* A message whose result the method returns straight away. It's encoded
+     * just like MESG_RESULT and is still followed by the return, which only
+     * runs if the interpreter couldn't replace the context with the new one.
+     */
+    const std::uint8_t MESG_TAIL          = 0x05; // obj res mesg_id pcnt ...
+
+    const std::uint8_t BLOCK_INLINE       = 0x09; // local body
     const std::uint8_t BLOCK              = 0x0a; // local locals block_size
     const std::uint8_t CONTEXT_END        = 0x0b;
 
+    /* The grinder compiles the literal blocks of isTrue:, isFalse: and
+     * timesDo: inline, jumping around them instead of creating a
+     * BlockContext. A jump's target is an offset from the start of the jump.
+     * When the receiver isn't a Boolean or an Integer the jump goes to the
+     * guard instead, where BLOCK_INLINE creates the blocks from the inlined
+     * code and the message is sent after all. Each inlined block ends with a
+     * JUMP that names the start of the block, which ends the block's context
+     * rather than jumping when the block is running as its own context.
+     */
+    const std::uint8_t JUMP               = 0x0c; // target block
+    const std::uint8_t JUMP_IF_TRUE       = 0x0d; // local target guard
+    const std::uint8_t JUMP_IF_FALSE      = 0x0e; // local target guard
+    const std::uint8_t LOOP               = 0x0f; // limit count target guard
+
     const std::uint8_t ASSIGN             = 0x10; // local local
     const std::uint8_t ASSIGN_PROP        = 0x11; // local object_attr
     const std::uint8_t ASSIGN_CLASS_PROP  = 0x12; // local class_attr
@@ -53,6 +75,16 @@ namespace meat {
     const std::uint8_t SET_PROP           = 0x20; // attr local
     const std::uint8_t SET_CLASS_PROP     = 0x21; // attr const
 
+    /* Quickened instructions. These never appear in the bytecode, the
+     * interpreter rewrites the predecoded instructions into them after the
+     * generic instruction has run.
+     */
+    const std::uint8_t CALL_NATIVE        = 0x30;
+    const std::uint8_t CALL_NATIVE_RESULT = 0x31;
+    const std::uint8_t LOAD_RESOLVED_CLASS = 0x32;
+    const std::uint8_t INT_ADD            = 0x33;
+    const std::uint8_t INT_SUB            = 0x34;
+
     typedef struct __attribute__((packed)) _message_s {
       std::uint8_t object;
       std::uint32_t message_id;
@@ -74,6 +106,29 @@ namespace meat {
       std::uint16_t code_size;
     } block_context_t;
 
+    typedef struct __attribute__((packed)) _block_inline_s {
+      std::uint8_t result;
+      std::int16_t body;
+    } block_inline_t;
+
+    typedef struct __attribute__((packed)) _jump_s {
+      std::int16_t target;
+      std::int16_t block;   // Zero if the jump doesn't end an inlined block
+    } jump_t;
+
+    typedef struct __attribute__((packed)) _jump_if_s {
+      std::uint8_t condition;
+      std::int16_t target;
+      std::int16_t guard;
+    } jump_if_t;
+
+    typedef struct __attribute__((packed)) _loop_s {
+      std::uint8_t limit;
+      std::uint8_t count;
+      std::int16_t target;
+      std::int16_t guard;
+    } loop_t;
+
     typedef struct __attribute__((packed)) _assign_s {
       std::uint8_t destination;
       std::uint8_t source;
@@ -122,6 +177,10 @@ namespace meat {
         message_t m;
         message_result_t mr;
         block_context_t bc;
+        block_inline_t bi;
+        jump_t j;
+        jump_if_t ji;
+        loop_t l;
         assign_t a;
         assign_property_t ap;
         class_t c;
@@ -132,6 +191,32 @@ namespace meat {
         set_property_t sp;
       } o;
     } bytecode_t;
+
+    /** A predecoded instruction. When a class's bytecode is installed it's
+     * converted into an array of these, with the operands in native byte
+     * order and the following instruction resolved to an index. Interpreter
+     * instruction pointers index this array rather than the bytecode.
+     */
+    typedef struct _instruction_s {
+      std::uint8_t code;
+      std::uint8_t destination;   // Result, destination or property to set
+      std::uint8_t source;        // Object, source, property or block local
+      std::uint8_t count;         // Parameters, locals or block local index
+      std::uint16_t offset;       // Offset of the instruction in the bytecode
+      std::uint16_t next;         // Index of the next instruction, after a
+                                  // BLOCK this skips over the block's code
+      std::uint32_t value;        // Message or class id
+      std::uint16_t slot;         // First constant pool slot used
+      std::uint8_t generic;       // Code a quickened instruction reverts to
+      std::uint8_t deopts;        // Times the instruction was deoptimized
+      std::uint32_t epoch;        // Method cache epoch it was quickened in
+      std::uint16_t target;       // Index a jump goes to or a block starts at
+      std::uint16_t guard;        // Index a jump goes to when the guard
+                                  // fails, for a JUMP the block it ends
+      const std::uint8_t *parameter;  // Message parameter locals
+      InlineCache *cache;         // Message send site cache
+      const vtable_entry_t *method;   // Method of a quickened send
+    } instruction_t;
   }
 }
 
@@ -197,6 +197,19 @@ namespace meat {
     Archive &operator<<(Archive &archive, std::uint32_t value);
     Archive &operator<<(Archive &archive, std::int32_t value);
     Archive &operator<<(Archive &archive, double value);
+
+    /** Writes a snapshot of the heap to a file. Every object reachable from
+     * the recorded classes and the context chain is written with its class,
+     * the size of its block and the objects it references, for meat-grinder
+     * -d to analyse.
+     *
+     * @param filename The file to write the snapshot to.
+     * @param context The active context, the contexts that messaged it are
+     *                included through it.
+     * @exception Exception If the file couldn't be written.
+     */
+    DECLSPEC void heap_snapshot(const std::string &filename,
+                                Reference context = Reference());
   }
 }
 
@@ -18,40 +18,201 @@
  */
 
 #include <ctime>
-#include <map>
+#include <cstddef>
+#include <cstdint>
 #include <new>
+#include <type_traits>
+#include <utility>
 
 #ifndef _MEAT_MEMORY_H
 #define _MEAT_MEMORY_H
 
 namespace memory {
 
+  class collectable;
+
   /** Garbage collector for recyclable objects.
+   *
+   *  Recyclable objects are allocated from slabs of equal sized blocks, with
+   * a list of slabs that have free blocks kept for each size class. Slabs
+   * that become empty are kept for reuse until they're older than
+   * collection_age or there's more than limit bytes of them, then they're
+   * given back to the system.
+   *
+   *  Each thread allocates from its own heap of slabs without locking.
+   * Blocks can be recycled from any thread, those from another thread's heap
+   * are queued for that thread to recycle at its next collection step.
+   *
+   *  The collector works in steps. A step is due after collection_interval
+   * allocations, when the empty slabs grow past limit or when enough
+   * possible roots of garbage cycles have been buffered. Each step looks
+   * for cycles from at most cycle_budget roots and gives back at most
+   * collection_budget of the oldest empty slabs.
    */
   class gc {
   public:
     static std::size_t limit;
     static time_t collection_age;
 
+    /** The number of allocations between collection steps, zero to never
+     * step because of allocations.
+     */
+    static std::size_t collection_interval;
+
+    /** The most empty slabs a collection step gives back, zero for no limit.
+     */
+    static std::size_t collection_budget;
+
+    /** The occupancy of one of the allocator's size classes.
+     */
+    typedef struct _size_class_s {
+      std::size_t block_size;
+      std::size_t slabs;
+      std::size_t blocks;     // The number of blocks the slabs hold.
+      std::size_t used;       // The number of blocks allocated.
+    } size_class_t;
+
     static void *alloc(std::size_t size);
 
     static void recycle(void *ptr) noexcept;
 
+    /** Returns the start of the block that @c ptr points into.
+     */
+    static void *block(const void *ptr) noexcept;
+
+    /** Returns the size of the block that @c ptr points into.
+     */
+    static std::size_t block_size(const void *ptr) noexcept;
+
+    /** Tests if a collection step is due.
+     */
+    static bool collection_due(void);
+
+    /** Does one bounded collection step.
+     */
     static void collect(void);
 
+    /** Collects all the garbage cycles and gives back every empty slab.
+     */
     static void collect_all(void);
 
+    /** Returns the number of size classes.
+     */
+    static std::size_t size_classes(void);
+
+    /** Returns the occupancy of a size class.
+     * @param index The size class, from 0 to size_classes() - 1.
+     */
+    static size_class_t occupancy(std::size_t index);
+
+    /** Allocator statistics.
+     */
+    typedef struct _stats_s {
+      std::size_t allocations;   // Blocks ever allocated.
+      std::size_t reused;        // Allocations that reused a recycled block.
+      std::size_t recycled;      // Blocks ever recycled.
+      std::size_t bytes;         // Bytes allocated now.
+      std::size_t peak_bytes;    // The most bytes allocated at once.
+      std::size_t large_objects; // Objects too large for the size classes.
+      std::size_t slabs;
+      std::size_t slab_bytes;    // Bytes taken from the system.
+      std::size_t empty_bytes;   // Bytes held by empty slabs.
+    } stats_t;
+
+    /** Returns the allocator's statistics. The free list hit rate is
+     * reused / allocations.
+     */
+    static stats_t stats(void);
+
+    /** Cycle collector statistics.
+     */
+    typedef struct _cycle_stats_s {
+      std::size_t collections;
+      std::size_t buffered;   // Possible roots waiting to be examined.
+      std::size_t examined;   // Possible roots examined.
+      std::size_t traced;     // Objects traced while examining them.
+      std::size_t garbage;    // Objects found in garbage cycles.
+    } cycle_stats_t;
+
+    /** The number of possible roots a cycle collection examines, zero for no
+     * limit.
+     */
+    static std::size_t cycle_budget;
+
+    /** The number of buffered possible roots at which cycles_due() is true.
+     */
+    static std::size_t cycle_threshold;
+
+    /** Looks for garbage cycles of collectable objects from the buffered
+     * possible roots, examining at most cycle_budget of them. Objects in a
+     * garbage cycle are unlinked from each other and then released.
+     *
+     *  This must only be called where no object is being referenced by
+     * anything other than a reference, since raw pointers to objects aren't
+     * seen by the collector.
+     *
+     * @return The number of objects found in garbage cycles.
+     */
+    static std::size_t collect_cycles(void);
+
+    /** Tests if enough possible roots have been buffered for a cycle
+     * collection.
+     */
+    static bool cycles_due(void);
+
+    static cycle_stats_t cycle_stats(void);
+
     //static void finalize()
 
   private:
-    static std::multimap<std::size_t, void *> free_memory;
-    static std::size_t free_size;
+    friend class collectable;
+    template <typename Ty> friend class reference;
+
+    // The colours of collectable objects in the cycle collector.
+    enum {
+      BLACK,  // In use.
+      GRAY,   // Possible member of a cycle.
+      WHITE,  // Member of a garbage cycle.
+      PURPLE  // Possible root of a cycle.
+    };
+
+    static void possible_root(collectable *obj);
+    static void forget_root(collectable *obj);
+    static void mark_gray(collectable *obj);
+    static void scan(collectable *obj);
+    static void scan_black(collectable *obj);
+    static void collect_white(collectable *obj);
   };
 
-  /**
+  /** Base class for objects allocated by the garbage collector.
+   *
+   *  A recyclable object also carries its own reference counts, so a
+   * reference to it is just a pointer to the object. Copying an object never
+   * copies its counts.
+   *
+   *  The counts are a header created in storage of their own at the start of
+   * the recyclable part of the object, and they're never destroyed. They
+   * outlive the object's destructor, so weak references and the cycle
+   * collector can still use them until the object's block is recycled.
    */
   class recyclable {
   public:
+    typedef struct _counts_s {
+      std::uint32_t refs;          // The number of references.
+      std::uint32_t wrefs : 24;    // The number of weak references.
+      std::uint32_t overflow : 1;  // More weak references are overflowed.
+
+      // Used by the cycle collector for collectable objects.
+      std::uint32_t color : 2;
+      std::uint32_t buffered : 1;  // Buffered as a possible root.
+      std::uint32_t acyclic : 1;   // Can't be part of a cycle.
+    } counts_t;
+
+    recyclable() { new (_counts) counts_t(); }
+    recyclable(const recyclable &) { new (_counts) counts_t(); }
+
+    recyclable &operator=(const recyclable &) { return *this; }
+
     void *operator new(std::size_t size);
 
     void *operator new[](std::size_t size);
@@ -59,15 +220,135 @@ namespace memory {
     void operator delete(void *ptr) noexcept;
 
     void operator delete[](void *ptr) noexcept;
+
+  private:
+    template <typename Ty> friend class reference;
+    friend class collectable;
+    friend class gc;
+
+    static const std::uint32_t MAX_WREFS = 0xffffff;
+
+    counts_t *counts() { return reinterpret_cast<counts_t *>(_counts); }
+
+    /** Adds a weak reference to the counts. Once the count is full the
+     * weak references past it are counted in an overflow table instead.
+     */
+    static void weak(counts_t *cnt) {
+      if (cnt->wrefs == MAX_WREFS) overflow_weak(cnt);
+      else cnt->wrefs++;
+    }
+
+    /** Removes a weak reference from the counts.
+     * @return True if it was the last weak reference.
+     */
+    static bool unweak(counts_t *cnt) {
+      if (cnt->overflow) {
+        underflow_weak(cnt);
+        return false;
+      }
+      return (--cnt->wrefs == 0);
+    }
+
+    /** Returns the number of weak references, including any overflowed.
+     */
+    static std::size_t weak_count(const counts_t *cnt) {
+      return (cnt->overflow ? MAX_WREFS + overflowed_weak(cnt) : cnt->wrefs);
+    }
+
+    static void overflow_weak(counts_t *cnt);
+    static void underflow_weak(counts_t *cnt);
+    static std::size_t overflowed_weak(const counts_t *cnt);
+
+    alignas(counts_t) unsigned char _counts[sizeof(counts_t)];
+  };
+
+  template <typename Ty> class reference;
+
+  /** A recyclable object that can be part of a reference cycle.
+   *
+   *  Whenever a reference to a collectable object is released without
+   * destroying it, the object is buffered as a possible root of a garbage
+   * cycle. gc::collect_cycles() then does a trial deletion of the references
+   * the possible roots hold, as described by Bacon and Rajan in "Concurrent
+   * Cycle Collection in Reference Counted Systems", to find the objects that
+   * are only referenced by each other.
+   *
+   *  Objects that can't hold references to themselves, directly or through
+   * other objects, should set themselves acyclic so they're never buffered.
+   */
+  class collectable : public recyclable {
+  public:
+
+    /** Visits the references a collectable object holds.
+     */
+    class tracer {
+    public:
+      /**
+       * @param acyclic Visit references to acyclic objects as well.
+       */
+      explicit tracer(bool acyclic = false) : _all(acyclic) {}
+      virtual ~tracer() throw() {}
+
+      /** Visit a reference. Null and weak references are ignored, as are
+       * references to acyclic objects unless the tracer was asked for them.
+       */
+      template <typename Ty>
+      void operator()(const reference<Ty> &ref) {
+        if (ref.ptr and not (ref.ptr & (reference<Ty>::WEAK |
+                                        reference<Ty>::IMMEDIATE))) {
+          collectable *obj = ref.object();
+          if (not obj->counts()->acyclic or _all) visit(obj);
+        }
+      }
+
+    protected:
+      virtual void visit(collectable *obj) = 0;
+
+    private:
+      bool _all;
+    };
+
+    virtual ~collectable() throw();
+
+    /** Calls @c visit for every reference the object holds. Only references
+     * the object owns may be visited, and each only once.
+     */
+    virtual void trace(tracer &visit) { (void)visit; }
+
+    /** Releases the references the object holds. This is called on the
+     * objects of a garbage cycle before they're released, to break the
+     * cycle.
+     */
+    virtual void unlink() {}
+
+  protected:
+    /** Sets if the object can be part of a reference cycle.
+     */
+    void acyclic(bool value) { counts()->acyclic = value; }
   };
 
+  /** Reference counting smart pointer.
+   *
+   *  When Ty is recyclable the counts are kept in the object itself and the
+   * reference points to the counts, otherwise they're kept in a separately
+   * allocated __reference wrapper. Either way the reference is a single
+   * pointer, with the lowest bit set if it's a weak reference.
+   *
+   *  A reference can also hold a small signed integer in place of the
+   * pointer, marked by the second lowest bit. These immediate values aren't
+   * objects at all, they have no counts and are never dereferenced.
+   *
+   *  An object is destroyed when its last normal reference is released.
+   * Weak references to it then report being null, and for recyclable objects
+   * the object's block isn't recycled until the last weak reference is gone.
+   */
   template <typename Ty>
-  class reference : public recyclable {
+  class reference {
   private:
 
     /** Reference Counting Class Wrapper.
      *  Used by reference to implement reference counting around a
-     * dynamically created object of type Ty.
+     * dynamically created object of type Ty that isn't recyclable.
      */
     class __reference {
     public:
@@ -114,9 +395,6 @@ namespace memory {
       /** Get the current reference count. */
       unsigned int __ref_cnt() const { return refs; }
 
-      /** Cast this as a reference to the object being wrapped. */
-      operator Ty &() { return (Ty &)*nobj; }
-
       /** Cast this as a pointer to the object being wrapped. */
       operator Ty*() { return (Ty *)nobj; }
 
@@ -126,82 +404,128 @@ namespace memory {
       Ty *nobj;           // The actual object.
     };
 
+    /* Selects between the intrusive counts of recyclable objects and the
+     * __reference wrapper. This is only evaluated in the member functions so
+     * a reference can be declared before Ty is complete.
+     */
+    typedef std::true_type intrusive;
+    typedef std::false_type wrapped;
+
+    template <typename Obj = Ty>
+    static typename std::is_base_of<recyclable, Obj>::type counting() {
+      return typename std::is_base_of<recyclable, Obj>::type();
+    }
+
+    static const std::uintptr_t WEAK = 1;
+    static const std::uintptr_t IMMEDIATE = 2;
+
+    friend class collectable::tracer;
+
   public:
+    /** The range of integers an immediate reference can hold, the pointer
+     * less the two tag bits.
+     */
+    static const std::intptr_t IMMEDIATE_MIN = INTPTR_MIN >> 2;
+    static const std::intptr_t IMMEDIATE_MAX = INTPTR_MAX >> 2;
+
     /** Create a null reference pointer.
      */
-    reference(void) : weak_ref(false), obj(nullptr) {
+    reference(void) : ptr(0) {
     }
 
-    /** Create a new reference to a newly allocated object.
+    /** Create a new reference to an object. For recyclable objects this just
+     * adds a reference to the object's own count, for anything else the
+     * object must be newly allocated.
      */
-    reference(Ty *obj) : weak_ref(false), obj(nullptr) {
-      if (obj != nullptr) this->obj = new __reference(obj, 1);
+    reference(Ty *obj) : ptr(0) {
+      if (obj != nullptr) ptr = attach(obj, counting());
     }
 
     /** Default copy constructor.
      */
-    reference(const reference<Ty> &obj)
-      : weak_ref(obj.weak_ref), obj(obj.obj) {
+    reference(const reference<Ty> &obj) : ptr(obj.ptr) {
       inc_reference();
     }
 
+    /** Takes over the reference from @c obj, leaving @c obj null. The
+     * reference counts are left untouched.
+     */
+    reference(reference<Ty> &&obj) noexcept : ptr(obj.ptr) {
+      obj.ptr = 0;
+    }
+
     /** Decreases the reference count and clean up the object if necessary.
      */
     ~reference(void) throw() {
-      if (obj) {
-        if (weak_ref) {
-          obj->dec_weak_ref();
-          if (obj->__ref_cnt() == 0 and obj->__wref_cnt() == 0) {
-            delete obj; obj = nullptr;
-          }
-        } else {
-          obj->dec_ref();
-          if (obj->__ref_cnt() == 0) {
-            if (obj->__wref_cnt()) {
-              obj->free();
-            } else {
-              delete obj; obj = nullptr;
-            }
-          }
-        }
-      }
+      dec_reference();
     }
 
     /** Get the number of references to a object.
      * @return The number of references
      */
     unsigned int references(void) {
-      return (obj != nullptr ? obj->__ref_cnt() : 0);
+      return (counted() ? refs(counting()) : 0);
     }
 
     unsigned int weak_references(void) {
-      return (obj != nullptr ? obj->__wref_cnt() : 0);
+      return (counted() ? wrefs(counting()) : 0);
+    }
+
+    /** Tests if @c value can be held in an immediate reference.
+     */
+    static bool fits_immediate(std::intmax_t value) {
+      return (value >= IMMEDIATE_MIN and value <= IMMEDIATE_MAX);
+    }
+
+    /** Creates an immediate reference holding @c value, which must fit.
+     */
+    static reference immediate(std::intptr_t value) {
+      reference result;
+      result.ptr = ((std::uintptr_t)value << 2) | IMMEDIATE;
+      return result;
+    }
+
+    /** Tests if the reference holds an immediate value instead of an object.
+     */
+    bool is_immediate(void) const {
+      return (ptr & IMMEDIATE);
+    }
+
+    /** Get the value of an immediate reference.
+     */
+    std::intptr_t immediate(void) const {
+      return ((std::intptr_t)ptr >> 2);
     }
 
     /** Test if we reference an object or just a NULL pointer.
      * @return If true if the reference in pointing to null.
      */
     bool is_null(void) const {
-      return ((obj == nullptr) or obj->is_null());
+      return (ptr == 0 or ((ptr & WEAK) and dead(counting())));
     }
 
     /** Creates a new weak reference.
      */
     reference weak(void) {
+      if (ptr & IMMEDIATE) return *this;
       reference result;
-      result.obj = obj;
-      result.weak_ref = true;
-      result.inc_reference();
+      if (ptr) {
+        result.ptr = ptr | WEAK;
+        result.inc_reference();
+      }
       return result;
     }
 
-    /** Creates a new normal reference.
+    /** Creates a new normal reference. A weak reference to an object that's
+     * been destroyed gives a null reference.
      */
     reference normal(void) {
+      if (ptr & IMMEDIATE) return *this;
       reference result;
-      result.obj = obj;
-      result.weak_ref = false;
-      result.inc_reference();
+      if (ptr and not dead(counting())) {
+        result.ptr = ptr & ~WEAK;
+        result.inc_reference();
+      }
       return result;
     }
 
@@ -209,14 +533,15 @@ namespace memory {
      * @return True if the reference is a weak reference otherwise false.
      */
     bool is_weak() {
-      return weak_ref;
+      return (ptr & WEAK);
     }
 
-    /** Decrement any current reference and create a new reference for the
-     * the new unreference object. @b Note that this could be dangerous
-     * if there is anothor reference already referencing @c obj. If
-     * another reference is referencing @c obj then this will cause obj
-     * to be destroyed twice.
+    /** Decrement any current reference and reference @c obj.
+     *
+     *  For recyclable objects this is always safe. For any other type @c obj
+     * must be newly allocated, since a new reference count is created for it.
+     * If another reference is already referencing @c obj then this will cause
+     * obj to be destroyed twice.
      *
      * Example
      * @code
@@ -240,29 +565,41 @@ namespace memory {
      * }
      * @endcode
      * Basically you'll want to be very careful when passing around the
-     * @c this pointer when using References. This is the greatest trigger
-     * of this feature (@e or @e bug ;).
+     * @c this pointer when using References to objects that aren't
+     * recyclable. This is the greatest trigger of this feature
+     * (@e or @e bug ;).
      *
-     * @param obj A newly created object we want to reference.
+     * @param obj The object we want to reference.
      * @return A C++ reference of this.
      */
     reference<Ty> &operator=(Ty *obj) {
-      dec_reference();
-      if (obj) {
-        this->obj = new __reference(obj, 1);
-      } else
-        this->obj = nullptr;
+      std::uintptr_t old = ptr;
+      ptr = (obj ? attach(obj, counting()) : 0);
+      release(old);
       return *this;
     }
 
     /** Decrement any current reference and reference the passed object.
      */
     reference<Ty> &operator=(const reference<Ty> &obj) {
-      if (this != &obj) {
-        dec_reference();
-        this->obj = obj.obj;
-        this->weak_ref = obj.weak_ref;
+      if (ptr != obj.ptr) {
+        std::uintptr_t old = ptr;
+        ptr = obj.ptr;
         inc_reference();
+        release(old);
+      }
+      return *this;
+    }
+
+    /** Decrement any current reference and take over the reference from
+     * @c obj, leaving @c obj null.
+     */
+    reference<Ty> &operator=(reference<Ty> &&obj) noexcept {
+      if (this != &obj) {
+        std::uintptr_t old = ptr;
+        ptr = obj.ptr;
+        obj.ptr = 0;
+        release(old);
       }
       return *this;
     }
@@ -270,19 +607,20 @@ namespace memory {
     /** Check if the reference is referencing the same object as @c other.
      */
     bool operator ==(const reference<Ty> &other) const {
-      return (obj == other.obj);
+      return ((ptr & ~WEAK) == (other.ptr & ~WEAK));
     }
 
     /** Check if the reference is referencing the same object as @c other.
      */
     bool operator ==(const Ty *other) const {
-      return ((Ty *)(obj) == other);
+      if (ptr & IMMEDIATE) return false;
+      return ((is_null() ? nullptr : object()) == other);
     }
 
     /** Check if the reference is referencing a different object as @c other.
      */
     bool operator !=(const reference<Ty> &other) const {
-      return (this->obj != other.obj);
+      return ((ptr & ~WEAK) != (other.ptr & ~WEAK));
     }
 
     reference &operator ++(void) { inc_reference(); return *this; }
@@ -290,50 +628,158 @@ namespace memory {
 
     /** Dereference the reference.
      */
-    Ty &operator *(void) { return (Ty &)(*obj); }
+    Ty &operator *(void) { return *object(); }
 
     /** Constant dereference the reference.
      */
-    const Ty &operator *(void) const { return (Ty &)(*obj); }
-    Ty *operator ->() { return (Ty *)(*obj); }
-    const Ty *operator ->(void) const { return (Ty *)(*obj); }
-    operator Ty &(void) { return (Ty &)(*obj); }
-    operator const Ty &(void) const { return (Ty &)(*obj); }
+    const Ty &operator *(void) const { return *object(); }
+    Ty *operator ->() { return object(); }
+    const Ty *operator ->(void) const { return object(); }
+    operator Ty &(void) { return *object(); }
+    operator const Ty &(void) const { return *object(); }
+
+    void *operator new(std::size_t size) { return gc::alloc(size); }
+    void *operator new[](std::size_t size) { return gc::alloc(size); }
+    void operator delete(void *ptr) noexcept { gc::recycle(ptr); }
+    void operator delete[](void *ptr) noexcept { gc::recycle(ptr); }
 
   private:
 
-    void dec_reference() throw() {
-      if (obj) {
-        if (weak_ref) {
-          obj->dec_weak_ref();
-          if (obj->__ref_cnt() == 0 and obj->__wref_cnt() == 0) {
-            delete obj; obj = nullptr;
-          }
-        } else {
-          obj->dec_ref();
-          if (obj->__ref_cnt() == 0) {
-            if (obj->__wref_cnt())
-              obj->free();
-            else {
-              delete obj; obj = nullptr;
-            }
-          }
-        }
+    /** Tests if the reference points to counts, it's not null or immediate.
+     */
+    bool counted() const { return (ptr and not (ptr & IMMEDIATE)); }
+
+    Ty *object() const { return object(ptr, counting()); }
+
+    static Ty *object(std::uintptr_t ptr, intrusive) {
+      return static_cast<Ty *>((recyclable *)(ptr & ~WEAK));
+    }
+
+    static Ty *object(std::uintptr_t ptr, wrapped) {
+      __reference *wrapper = (__reference *)(ptr & ~WEAK);
+      return (wrapper ? (Ty *)(*wrapper) : nullptr);
+    }
+
+    /* The counts are at the start of the recyclable object, they're found
+     * without touching the object since it may have been destroyed.
+     */
+    recyclable::counts_t *counts() const { return counts(ptr); }
+
+    static recyclable::counts_t *counts(std::uintptr_t ptr) {
+      return (recyclable::counts_t *)(ptr & ~WEAK);
+    }
+
+    __reference *wrapper() const { return (__reference *)(ptr & ~WEAK); }
+
+    static std::uintptr_t attach(Ty *obj, intrusive) {
+      recyclable *cnt = static_cast<recyclable *>(obj);
+      cnt->counts()->refs++;
+      return (std::uintptr_t)cnt;
+    }
+
+    static std::uintptr_t attach(Ty *obj, wrapped) {
+      return (std::uintptr_t)new __reference(obj, 1);
+    }
+
+    unsigned int refs(intrusive) const { return counts()->refs; }
+    unsigned int refs(wrapped) const { return wrapper()->__ref_cnt(); }
+    unsigned int wrefs(intrusive) const {
+      return recyclable::weak_count(counts());
+    }
+    unsigned int wrefs(wrapped) const { return wrapper()->__wref_cnt(); }
+    bool dead(intrusive) const { return (counts()->refs == 0); }
+    bool dead(wrapped) const { return wrapper()->is_null(); }
+
+    void inc_reference() { acquire(ptr, counting()); }
+
+    void dec_reference() throw() { release(ptr); }
+
+    static void acquire(std::uintptr_t ptr, intrusive) {
+      if (ptr and not (ptr & IMMEDIATE)) {
+        if (ptr & WEAK) recyclable::weak(counts(ptr));
+        else counts(ptr)->refs++;
+      }
+    }
+
+    static void acquire(std::uintptr_t ptr, wrapped) {
+      if (ptr and not (ptr & IMMEDIATE)) {
+        __reference *obj = (__reference *)(ptr & ~WEAK);
+        if (ptr & WEAK) obj->inc_weak_ref();
+        else obj->inc_ref();
       }
     }
 
-    void inc_reference() {
-      if (obj) {
-        if (weak_ref)
-          obj->inc_weak_ref();
-        else
-          obj->inc_ref();
+    static void release(std::uintptr_t ptr) throw() {
+      if (ptr and not (ptr & IMMEDIATE)) release(ptr, counting());
+    }
+
+    static void release(std::uintptr_t ptr, intrusive) throw() {
+      recyclable::counts_t *cnt = counts(ptr);
+      if (ptr & WEAK) {
+        // The last weak reference to a destroyed object frees its block.
+        if (recyclable::unweak(cnt) and cnt->refs == 0)
+          gc::recycle(gc::block(cnt));
+      } else if (--cnt->refs == 0) {
+        destroy(object(ptr, intrusive()));
+      } else {
+        possible_root(object(ptr, intrusive()),
+                      std::is_base_of<collectable, Ty>());
       }
     }
 
-    bool weak_ref;
-    __reference *obj;
+    /* A collectable object that's still referenced after a reference to it
+     * is released may be part of a garbage cycle.
+     */
+    static void possible_root(Ty *obj, std::true_type) {
+      collectable *root = static_cast<collectable *>(obj);
+      recyclable::counts_t *cnt = root->counts();
+      if (not cnt->acyclic and
+          (cnt->color != gc::PURPLE or not cnt->buffered))
+        gc::possible_root(root);
+    }
+
+    static void possible_root(Ty *obj, std::false_type) { (void)obj; }
+
+    static void release(std::uintptr_t ptr, wrapped) throw() {
+      __reference *obj = (__reference *)(ptr & ~WEAK);
+      if (ptr & WEAK) {
+        obj->dec_weak_ref();
+        if (obj->__ref_cnt() == 0 and obj->__wref_cnt() == 0)
+          delete obj;
+      } else {
+        obj->dec_ref();
+        if (obj->__ref_cnt() == 0) {
+          if (obj->__wref_cnt())
+            obj->free();
+          else
+            delete obj;
+        }
+      }
+    }
+
+    /** Destroys a recyclable object that has no references left. The
+     * object's destructor is run in place while holding a weak reference to
+     * it, so weak references made and released by the destructor itself
+     * can't recycle the block out from under it. If weak references are
+     * still left afterwards, the block is kept until they're released.
+     */
+    static void destroy(Ty *obj) throw() {
+      recyclable::counts_t *cnt = static_cast<recyclable *>(obj)->counts();
+      void *block = start(obj, std::is_polymorphic<Ty>());
+
+      recyclable::weak(cnt);
+      obj->~Ty();
+      cnt->refs = 0;
+      if (recyclable::unweak(cnt)) gc::recycle(block);
+    }
+
+    static void *start(Ty *obj, std::true_type) {
+      return dynamic_cast<void *>(obj);
+    }
+
+    static void *start(Ty *obj, std::false_type) { return obj; }
 
+    std::uintptr_t ptr;
   };
 }
 #endif /* _MEAT_MEMORY_H */
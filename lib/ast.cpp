@@ -25,6 +25,8 @@
 #include "ast.h"
 #include <sstream>
 #include <cmath>
+#include <cstdlib>
+#include <new>
 
 #ifdef TESTING
 #include <testing.h>
@@ -80,6 +82,89 @@ std::uint8_t LocalVariable::index() const {
                   + _name + " reference.");
 }
 
+/******************************************************************************
+ * meat::grinder::ast::Arena Class
+ */
+
+#define ARENA_CHUNK (8192)
+#define ARENA_ALIGN (sizeof(void *) * 2)
+#define ARENA_ROUND(size) (((size) + ARENA_ALIGN - 1) & ~(ARENA_ALIGN - 1))
+
+/************************************
+ * meat::grinder::ast::Arena::Arena *
+ ************************************/
+
+Arena::Arena() : chunks(NULL), nodes(NULL) {
+}
+
+/*************************************
+ * meat::grinder::ast::Arena::~Arena *
+ *************************************/
+
+Arena::~Arena() throw() {
+  // Destroy all the nodes, then free the chunks they're in.
+  for (node_t *node = nodes; node; node = node->next)
+    ((Node *)((char *)node + ARENA_ROUND(sizeof(node_t))))->~Node();
+
+  while (chunks) {
+    chunk_t *chunk = chunks;
+    chunks = chunk->next;
+    std::free(chunk);
+  }
+}
+
+/************************************
+ * meat::grinder::ast::Arena::alloc *
+ ************************************/
+
+void *Arena::alloc(std::size_t size) {
+  size = ARENA_ROUND(size);
+
+  if (chunks == NULL or chunks->used + size > chunks->size) {
+    // Start a new chunk, large enough for the allocation.
+    std::size_t chunk_size = ARENA_ROUND(sizeof(chunk_t)) + size;
+    if (chunk_size < ARENA_CHUNK) chunk_size = ARENA_CHUNK;
+
+    chunk_t *chunk = (chunk_t *)std::malloc(chunk_size);
+    if (chunk == NULL) throw std::bad_alloc();
+    chunk->next = chunks;
+    chunk->size = chunk_size;
+    chunk->used = ARENA_ROUND(sizeof(chunk_t));
+    chunks = chunk;
+  }
+
+  void *ptr = (char *)chunks + chunks->used;
+  chunks->used += size;
+  return ptr;
+}
+
+/*****************************************
+ * meat::grinder::ast::Arena::alloc_node *
+ *****************************************/
+
+void *Arena::alloc_node(std::size_t size) {
+  /*  Each node is kept on a list so the arena can destroy it, the list
+   * entry is just before the node.
+   */
+  node_t *node = (node_t *)alloc(ARENA_ROUND(sizeof(node_t)) + size);
+  node->next = nodes;
+  nodes = node;
+  return (char *)node + ARENA_ROUND(sizeof(node_t));
+}
+
+/*******************************************
+ * meat::grinder::ast::Arena::abandon_node *
+ *******************************************/
+
+void Arena::abandon_node(void *ptr) {
+  /*  The node's constructor failed so it mustn't be destroyed. Nodes don't
+   * create other nodes while they're being constructed, so it's the last
+   * one allocated.
+   */
+  if (nodes and (char *)nodes + ARENA_ROUND(sizeof(node_t)) == ptr)
+    nodes = nodes->next;
+}
+
 /******************************************************************************
  * meat::grinder::ast::Node Class
  */
@@ -98,6 +183,25 @@ Node::Node() : _scope(NULL), result_set(false), _x_temp_counter(0) {
 Node::~Node() throw() {
 }
 
+/******************************************
+ * meat::grinder::ast::Node::operator new *
+ ******************************************/
+
+void *Node::operator new(std::size_t size, Arena &arena) {
+  return arena.alloc_node(size);
+}
+
+/*********************************************
+ * meat::grinder::ast::Node::operator delete *
+ *********************************************/
+
+void Node::operator delete(void *ptr, Arena &arena) noexcept {
+  arena.abandon_node(ptr);
+}
+
+void Node::operator delete(void *ptr __attribute__((unused))) noexcept {
+}
+
 /***********************************
  * meat::grinder::ast::Node::scope *
  ***********************************/
@@ -248,8 +352,6 @@ Block::Block() : temp_counter(0) {
  *************************************/
 
 Block::~Block() noexcept {
-  for (auto &node: _nodes)
-    delete node;
 }
 
 /**********************************
@@ -302,6 +404,17 @@ LocalVariable Block::anon_local() {
   return local(temp_name.str());
 }
 
+/*****************************************
+ * meat::grinder::ast::Block::references *
+ *****************************************/
+
+bool Block::references(const std::string &name) const {
+  for (auto &node: _nodes) {
+    if (node->references(name)) return true;
+  }
+  return false;
+}
+
 /******************************************************************************
  * meat::grinder::ast::Method Class
  */
@@ -517,7 +630,7 @@ void Method::bytecode(double value) {
  * meat::grinder::ast::ContextBlock Class
  */
 
-ContextBlock::ContextBlock() {
+ContextBlock::ContextBlock() : _inline(false) {
 }
 
 ContextBlock::~ContextBlock() throw() {
@@ -580,7 +693,21 @@ std::uint8_t ContextBlock::locals() const {
   return _scope->locals() + _locals.size();
 }
 
+LocalVariable ContextBlock::local(const std::string &name) {
+  if (not _inline) return Block::local(name);
+
+  // Inlined blocks keep their local variables in the enclosing block.
+  bool found = false;
+  for (auto &local_name: _local_names) {
+    if (local_name == name) found = true;
+  }
+  if (not found) _local_names.push_back(name);
+  return scope().local(_prefix + name);
+}
+
 LocalVariable ContextBlock::anon_local() {
+  if (_inline) return scope().anon_local();
+
   std::stringstream temp_name;
   temp_name << ".anon.b." << (unsigned int)++temp_counter;
   return local(temp_name.str());
@@ -595,6 +722,13 @@ void ContextBlock::add_parameter(Identifier *parameter) {
 }
 
 LocalVariable ContextBlock::resolve_local(const std::string &name) const {
+  if (_inline) {
+    for (auto &local_name: _local_names) {
+      if (local_name == name) return Node::resolve_local(_prefix + name);
+    }
+    return Node::resolve_local(name);
+  }
+
   for (unsigned int index = 0; index < _locals.size(); index++) {
     if (_locals[index] == name)
       return LocalVariable(name, (Block &)*this);
@@ -611,6 +745,38 @@ std::uint8_t ContextBlock::local_count() const {
   return scope().locals() + _locals.size();
 }
 
+/*************************************************
+ * meat::grinder::ast::ContextBlock::make_inline *
+ *************************************************/
+
+void ContextBlock::make_inline() {
+  static unsigned int inlined = 0;
+
+  std::stringstream prefix;
+  prefix << ".b" << ++inlined << ".";
+  _prefix = prefix.str();
+  _inline = true;
+}
+
+/************************************************
+ * meat::grinder::ast::ContextBlock::gen_inline *
+ ************************************************/
+
+LocalVariable ContextBlock::gen_inline(unsigned int stage) {
+  if (stage == 2) {
+    // A local variable for the BlockContext, if it's needed after all.
+    _local_var = scope().anon_local();
+  }
+
+  for (auto &node: _nodes) {
+    temp_counter = node->temp_locals();
+    node->gen_bytecode(stage);
+    node->temp_locals(temp_counter);
+  }
+
+  return _local_var;
+}
+
 /******************************************************************************
  * meat::grinder::ast::Identifier Class
  */
@@ -788,7 +954,11 @@ LocalVariable Identifier::gen_result(unsigned int stage) {
       bytecode((uint32_t)hash(_name));
       return result;
     case LOCAL_VARIABLE:
-      if (result.name() != _name) {
+      /*  Resolve the local again, the block locals move along as locals are
+       * added to the blocks they're in.
+       */
+      _index = resolve_local(_name).index();
+      if (result.index() != _index) {
 #ifdef DEBUG_AST
         std::cout << "BC: MOV " << result.name() << " " << std::dec
                   << _name << std::endl;;
@@ -896,8 +1066,14 @@ Assignment::Assignment(Identifier *dest, Node *src)
 }
 
 Assignment::~Assignment() throw() {
-  delete _destination;
-  delete _source;
+}
+
+/**********************************************
+ * meat::grinder::ast::Assignment::references *
+ **********************************************/
+
+bool Assignment::references(const std::string &name) const {
+  return _destination->references(name) or _source->references(name);
 }
 
 /*****************************************
@@ -991,11 +1167,11 @@ LocalVariable Assignment::gen_result(unsigned int stage __attribute__((unused)))
  * meat::grinder::ast::Message::Message *
  ****************************************/
 
-Message::Message(Node *who) : _who(who) {
+Message::Message(Node *who) : _who(who), _tail(false), _inline(false) {
 }
 
 Message::Message(Node *who, const std::string &name)
-  : _who(who), _method(name) {
+  : _who(who), _method(name), _tail(false), _inline(false) {
 }
 
 /*****************************************
@@ -1003,11 +1179,6 @@ Message::Message(Node *who, const std::string &name)
  *****************************************/
 
 Message::~Message() throw() {
-  delete _who;
-
-  for (auto &node: _parameters)
-    delete node;
-  _parameters.clear();
 }
 
 /***************************************
@@ -1049,14 +1220,35 @@ void Message::scope(Block *block) {
     node->scope(block);
 }
 
+/*******************************************
+ * meat::grinder::ast::Message::references *
+ *******************************************/
+
+bool Message::references(const std::string &name) const {
+  if (_who->references(name)) return true;
+  for (auto &node: _parameters) {
+    if (node->references(name)) return true;
+  }
+  return false;
+}
+
 /*********************************************
  * meat::grinder::ast::Message::gen_bytecode *
  *********************************************/
 
 void Message::gen_bytecode(unsigned int stage) {
+  if (stage == 2) _inline = inlinable();
+  if (_inline) {
+    gen_inline(stage, false);
+    return;
+  }
+
+  Message *tail = tail_send();
+  if (tail) tail->_tail = true;
+
   LocalVariable who_var = _who->gen_result(stage);
 
-  std::deque<LocalVariable> param_idxs;
+  std::vector<LocalVariable> param_idxs;
   sort_parameters(stage, param_idxs);
 
   if (stage == 0) {
@@ -1098,9 +1290,15 @@ void Message::gen_bytecode(unsigned int stage) {
  *******************************************/
 
 LocalVariable Message::gen_result(unsigned int stage) {
+  if (stage == 2) _inline = inlinable();
+  if (_inline) {
+    gen_inline(stage, true);
+    return result;
+  }
+
   LocalVariable who_var = _who->gen_result(stage);
 
-  std::deque<LocalVariable> param_idxs;
+  std::vector<LocalVariable> param_idxs;
   sort_parameters(stage, param_idxs);
 
   set_result_dest();
@@ -1115,6 +1313,13 @@ LocalVariable Message::gen_result(unsigned int stage) {
                 << std::dec << (unsigned int)param_idxs.size();
 #endif
       bytecode(meat::bytecode::MESG_SUPER_RESULT);
+    } else if (_tail) {
+#ifdef DEBUG_AST
+      std::cout << "BC: MSGTAIL " << who_var.name() << " "
+                << result.name() << " " << _method << " "
+                << std::dec << (unsigned int)param_idxs.size();
+#endif
+      bytecode(meat::bytecode::MESG_TAIL);
     } else {
 #ifdef DEBUG_AST
       std::cout << "BC: MSGRES " << who_var.name() << " "
@@ -1144,14 +1349,244 @@ LocalVariable Message::gen_result(unsigned int stage) {
   return result;
 }
 
+/******************************************
+ * meat::grinder::ast::Message::tail_send *
+ ******************************************/
+
+Message *Message::tail_send() {
+  /*  Only a method's own context can be replaced, returning from a block
+   * context returns from the method it was created in.
+   */
+  if (_super or _method != "return:" or _parameters.size() != 1 or
+      dynamic_cast<Method *>(_scope) == nullptr)
+    return nullptr;
+
+  Identifier *who = dynamic_cast<Identifier *>(_who);
+  if (who == nullptr or who->name() != "context") return nullptr;
+
+  Message *tail = dynamic_cast<Message *>(_parameters[0]);
+  if (tail == nullptr or tail->_super) return nullptr;
+  return tail;
+}
+
+/******************************************
+ * meat::grinder::ast::Message::inlinable *
+ ******************************************/
+
+bool Message::inlinable() const {
+  /*  The blocks of the Boolean conditionals and of Integer timesDo: are
+   * compiled inline. A timesDo: block that uses its context is left as a
+   * block, the context is the loop's block context there.
+   */
+  bool loop = (_method == "timesDo:");
+  if (_super or
+      (not loop and _method != "isTrue:" and _method != "isFalse:" and
+       _method != "isTrue:else:" and _method != "isFalse:else:"))
+    return false;
+
+  for (auto &node: _parameters) {
+    if (not node->is_block()) return false;
+  }
+  return not (loop and _parameters[0]->references("context"));
+}
+
+/*******************************************
+ * meat::grinder::ast::Message::gen_inline *
+ *******************************************/
+
+void Message::gen_inline(unsigned int stage, bool has_result) {
+  /*  The receiver is tested first, with the code of the blocks following.
+   * If the receiver isn't a Boolean, or an Integer for timesDo:, the test
+   * goes to the fallback code instead, which creates the blocks from the
+   * inlined code and sends the message after all.
+   */
+  ContextBlock *body = static_cast<ContextBlock *>(_parameters[0]);
+  ContextBlock *else_body = nullptr;
+  if (_parameters.size() > 1)
+    else_body = static_cast<ContextBlock *>(_parameters[1]);
+  bool loop = (_method == "timesDo:");
+
+  if (stage == 2) {
+    body->make_inline();
+    if (else_body) else_body->make_inline();
+
+    if (loop) {
+      // The loop keeps its own limit, in case the block changes it.
+      _limit = anon_local();
+      _count = anon_local();
+      _who->set_result_dest(_limit);
+    }
+  }
+
+  LocalVariable who_var = _who->gen_result(stage);
+  if (has_result) set_result_dest();
+
+  if (stage == 0 and loop) {
+#ifdef DEBUG_AST
+    std::cout << "BC: CONST " << _count.name() << " 0" << std::endl;
+#endif
+    bytecode(meat::bytecode::ASSIGN_CONST_INT);
+    bytecode(_count.index());
+    bytecode((std::int32_t)0);
+  }
+
+  std::uint16_t test = bytecode();
+  std::uint16_t target_mark = 0, guard_mark = 0;
+  if (stage == 0) {
+    if (loop) {
+#ifdef DEBUG_AST
+      std::cout << "BC: LOOP " << _limit.name() << " " << _count.name()
+                << std::endl;
+#endif
+      bytecode(meat::bytecode::LOOP);
+      bytecode(_limit.index());
+      bytecode(_count.index());
+    } else {
+#ifdef DEBUG_AST
+      std::cout << "BC: JUMPIF " << who_var.name() << std::endl;
+#endif
+      if (_method.compare(0, 7, "isTrue:") == 0)
+        bytecode(meat::bytecode::JUMP_IF_FALSE);
+      else
+        bytecode(meat::bytecode::JUMP_IF_TRUE);
+      bytecode(who_var.index());
+    }
+    target_mark = bytecode();
+    bytecode((std::uint16_t)0);
+    guard_mark = bytecode();
+    bytecode((std::uint16_t)0);
+  }
+
+  // The jumps to the end, with the offsets to set once we get there.
+  std::vector<std::pair<std::uint16_t, std::uint16_t> > exits;
+
+  std::uint16_t body_start = bytecode();
+  LocalVariable body_var = body->gen_inline(stage);
+  if (stage == 0) {
+    std::uint16_t jump = gen_jump(body_start);
+    if (loop)
+      patch(jump, jump + 1, test);
+    else
+      exits.push_back(std::make_pair(jump, jump + 1));
+  }
+
+  std::uint16_t else_start = bytecode();
+  LocalVariable else_var;
+  if (else_body) {
+    if (stage == 0) patch(test, target_mark, else_start);
+    else_var = else_body->gen_inline(stage);
+    if (stage == 0) {
+      std::uint16_t jump = gen_jump(else_start);
+      exits.push_back(std::make_pair(jump, jump + 1));
+    }
+  } else if (stage == 0) {
+    exits.push_back(std::make_pair(test, target_mark));
+  }
+
+  if (stage == 0) {
+    // The fallback, creating the blocks and sending the message.
+    patch(test, guard_mark, bytecode());
+
+    std::vector<LocalVariable> param_idxs;
+    param_idxs.push_back(body_var);
+    if (else_body) param_idxs.push_back(else_var);
+
+    for (std::size_t c = 0; c < param_idxs.size(); c++) {
+      std::uint16_t start = bytecode();
+#ifdef DEBUG_AST
+      std::cout << "BC: BLOCK INLINE " << param_idxs[c].name() << std::endl;
+#endif
+      bytecode(meat::bytecode::BLOCK_INLINE);
+      bytecode(param_idxs[c].index());
+      bytecode((std::uint16_t)((c ? else_start : body_start) - start));
+    }
+    gen_send(loop ? _limit : who_var, param_idxs, has_result);
+
+    /*  The inlined blocks result in null, like the methods do. The message's
+     * own result is left as is.
+     */
+    if (has_result) {
+      std::uint16_t jump = gen_jump(0);
+      for (auto &exit: exits) patch(exit.first, exit.second, bytecode());
+      exits.clear();
+      exits.push_back(std::make_pair(jump, jump + 1));
+
+#ifdef DEBUG_AST
+      std::cout << "BC: MOV " << result.name() << " null" << std::endl;
+#endif
+      bytecode(meat::bytecode::ASSIGN);
+      bytecode(result.index());
+      bytecode((std::uint8_t)3);
+    }
+
+    for (auto &exit: exits) patch(exit.first, exit.second, bytecode());
+  }
+}
+
+/*****************************************
+ * meat::grinder::ast::Message::gen_send *
+ *****************************************/
+
+void Message::gen_send(LocalVariable who_var,
+                       const std::vector<LocalVariable> &param_idxs,
+                       bool has_result) {
+#ifdef DEBUG_AST
+  std::cout << "BC: " << (has_result ? "MSGRES " : "MESSAGE ")
+            << who_var.name() << " " << _method << " "
+            << std::dec << (unsigned int)param_idxs.size() << std::endl;
+#endif
+  if (has_result) {
+    bytecode(meat::bytecode::MESG_RESULT);
+    bytecode(who_var.index());
+    bytecode(result.index());
+  } else {
+    bytecode(meat::bytecode::MESSAGE);
+    bytecode(who_var.index());
+  }
+  bytecode((uint32_t)hash(_method));
+  bytecode((uint8_t)param_idxs.size());
+  for (auto &local: param_idxs)
+    bytecode(local.index());
+}
+
+/*****************************************
+ * meat::grinder::ast::Message::gen_jump *
+ *****************************************/
+
+std::uint16_t Message::gen_jump(std::uint16_t block) {
+  /*  The jump at the end of an inlined block names the start of the block,
+   * zero if the jump doesn't end a block.
+   */
+  std::uint16_t jump = bytecode();
+#ifdef DEBUG_AST
+  std::cout << "BC: JUMP" << std::endl;
+#endif
+  bytecode(meat::bytecode::JUMP);
+  bytecode((std::uint16_t)0);
+  bytecode((std::uint16_t)(block ? block - jump : 0));
+  return jump;
+}
+
+/**************************************
+ * meat::grinder::ast::Message::patch *
+ **************************************/
+
+void Message::patch(std::uint16_t jump, std::uint16_t marker,
+                    std::uint16_t target) {
+  // Jump offsets are relative to the start of the jump.
+  bytecode(marker, (std::uint16_t)(target - jump));
+}
+
 /************************************************
  * meat::grinder::ast::Message::sort_parameters *
  ************************************************/
 
 void Message::sort_parameters(unsigned int stage,
-                              std::deque<LocalVariable> &param_idxs) {
+                              std::vector<LocalVariable> &param_idxs) {
+  param_idxs.resize(_parameters.size());
+  std::size_t index = _parameters.size();
   for (auto it = _parameters.rbegin(); it != _parameters.rend(); ++it) {
-    param_idxs.push_front((*it)->gen_result(stage));
+    param_idxs[--index] = (*it)->gen_result(stage);
 
     // If the parameter is a block lets look for block parameters.
     if (stage == 2 and (*it)->is_block()) {
@@ -37,6 +37,45 @@ namespace meat {
 
       class Block;
       class Identifier;
+      class Node;
+
+      /** Owns the nodes of the abstract syntax trees built while compiling a
+       * method. Nodes are created with new (arena) from large chunks of
+       * memory and are all destroyed together with the arena, rather than
+       * each being allocated and freed on its own.
+       */
+      class Arena {
+      public:
+        Arena();
+        virtual ~Arena() throw();
+
+        /** Allocates memory from the arena. The memory is only given back
+         * when the arena is destroyed.
+         */
+        void *alloc(std::size_t size);
+
+      private:
+        friend class Node;
+
+        typedef struct _chunk_s {
+          struct _chunk_s *next;
+          std::size_t size;
+          std::size_t used;
+        } chunk_t;
+
+        typedef struct _node_s {
+          struct _node_s *next;  // The node allocated before this one.
+        } node_t;
+
+        chunk_t *chunks;
+        node_t *nodes;           // The most recently allocated node first.
+
+        void *alloc_node(std::size_t size);
+        void abandon_node(void *ptr);
+
+        Arena(const Arena &other);
+        Arena &operator =(const Arena &other);
+      };
 
       /**
        */
@@ -63,12 +102,24 @@ namespace meat {
         Node();
         virtual ~Node() throw();
 
+        /** Nodes can only be created in an Arena, which destroys them.
+         */
+        void *operator new(std::size_t size, Arena &arena);
+        void operator delete(void *ptr, Arena &arena) noexcept;
+
         virtual void gen_bytecode(unsigned int stage) = 0;
         virtual LocalVariable gen_result(unsigned int stage) = 0;
 
         virtual bool is_value() { return false; }
         virtual bool is_block() { return false; }
 
+        /** Returns true if the identifier name is used anywhere in the node.
+         */
+        virtual bool references(const std::string &name) const {
+          (void)name;
+          return false;
+        }
+
         virtual std::uint8_t locals() const;
         virtual LocalVariable local(const std::string &name);
         virtual LocalVariable anon_local();
@@ -116,6 +167,9 @@ namespace meat {
         virtual void bytecode(std::int32_t value);
         virtual void bytecode(double value);
 
+        // Only the Arena frees nodes, so this does nothing.
+        void operator delete(void *ptr) noexcept;
+
       private:
         unsigned int _x_temp_counter;
       };
@@ -144,11 +198,13 @@ namespace meat {
          */
         virtual LocalVariable anon_local();
 
+        virtual bool references(const std::string &name) const;
+
         friend class LocalVariable;
 
       protected:
         std::deque<std::string> _locals;
-        std::deque<Node *> _nodes;
+        std::vector<Node *> _nodes;
         unsigned int temp_counter;
 
         Block();
@@ -212,10 +268,24 @@ namespace meat {
         virtual bool is_block() { return true; }
 
         virtual std::uint8_t locals() const;
+        virtual LocalVariable local(const std::string &name);
         virtual LocalVariable anon_local();
 
         void add_parameter(Identifier *parameter);
 
+        /** Compile the block inline, into the code of the enclosing block.
+         * The block's local variables are then kept in the enclosing block
+         * under names of their own, so the same code also runs as a
+         * BlockContext without any locals. This has to be done before the
+         * block is compiled.
+         */
+        void make_inline();
+
+        /** Generates the inlined code for the block. The local variable
+         * returned is for the BlockContext if the block is created after all.
+         */
+        LocalVariable gen_inline(unsigned int stage);
+
       protected:
         virtual LocalVariable resolve_local(const std::string &name) const;
 
@@ -226,6 +296,9 @@ namespace meat {
         std::deque<std::string> _local_names;
 
         LocalVariable _local_var;
+
+        bool _inline;
+        std::string _prefix;  // Prefix for the inlined local variable names.
       };
 
       /**
@@ -248,6 +321,9 @@ namespace meat {
         void block_parameter(LocalVariable block, LocalVariable parameter);
 
         virtual bool is_value() { return true; }
+        virtual bool references(const std::string &name) const {
+          return _name == name;
+        }
 
         ident_type_t type() const { return _type; }
         std::uint8_t index() const { return _index; }
@@ -298,6 +374,8 @@ namespace meat {
 
         virtual void scope(Block *block);
 
+        virtual bool references(const std::string &name) const;
+
         virtual void gen_bytecode(unsigned int stage);
         virtual LocalVariable gen_result(unsigned int stage);
 
@@ -322,18 +400,36 @@ namespace meat {
 
         virtual void scope(Block *block);
 
+        virtual bool references(const std::string &name) const;
+
         virtual void gen_bytecode(unsigned int stage);
         virtual LocalVariable gen_result(unsigned int stage);
 
       private:
         Node *_who;
         std::string _method;
-        std::deque<Node *> _parameters;
+        std::vector<Node *> _parameters;
 
         bool _super;
+        bool _tail;  // The method returns our result straight away.
+        bool _inline; // The block parameters are compiled inline.
+
+        LocalVariable _limit;  // The limit and count of an inlined timesDo:
+        LocalVariable _count;
+
+        Message *tail_send();
+
+        bool inlinable() const;
+        void gen_inline(unsigned int stage, bool has_result);
+        void gen_send(LocalVariable who_var,
+                      const std::vector<LocalVariable> &param_idxs,
+                      bool has_result);
+        std::uint16_t gen_jump(std::uint16_t block);
+        void patch(std::uint16_t jump, std::uint16_t marker,
+                   std::uint16_t target);
 
         void sort_parameters(unsigned int stage,
-                             std::deque<LocalVariable> &param_idxs);
+                             std::vector<LocalVariable> &param_idxs);
       };
 
     } /* namespace ast */
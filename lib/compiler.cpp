@@ -151,6 +151,12 @@ meat::grinder::Token::Token(const Token &other)
     d_value(other.d_value), _position(other._position) {
 }
 
+meat::grinder::Token::Token(Token &&other)
+  : value_type(other.value_type), value(std::move(other.value)),
+    i_value(other.i_value), d_value(other.d_value),
+    _position(other._position) {
+}
+
 /********************************
  * meat::grinder::Token::~Token *
  ********************************/
@@ -340,7 +346,7 @@ unsigned int meat::grinder::SyntaxException::character() const {
  * Tokenizer::Tokenizer *
  ************************/
 
-meat::grinder::Tokenizer::Tokenizer() : stream(NULL) {
+meat::grinder::Tokenizer::Tokenizer() : stream(NULL), depth(0) {
   complete = false;
   cook_lines = true;
   cont_line = false;
@@ -379,21 +385,29 @@ void meat::grinder::Tokenizer::parse(const std::string &code) {
  **********************************/
 
 void meat::grinder::Tokenizer::push() {
-  Token current = tokens.front();
-
   // We only allow COMMAND and BLOCK to be pushed and reparsed.
-  if (not current.is_type(Token::COMMAND) and
-      not current.is_type(Token::BLOCK)) {
-    throw SyntaxException(current, "Internal error reparsing token");
+  if (not tokens.front().is_type(Token::COMMAND) and
+      not tokens.front().is_type(Token::BLOCK)) {
+    throw SyntaxException(tokens.front(), "Internal error reparsing token");
   }
 
+  Token current = std::move(tokens.front());
+
   // Remove the token and save the state of the tokenizer.
   tokens.pop_front();
-  states.push({tokens, remaining, stream, current_line, current_token});
+  if (depth == states.size()) states.emplace_back();
+  stack_s &state = states[depth++];
+  state.tokens.swap(tokens);
+  state.remaining.swap(remaining);
+  state.stream = stream;
+  state.current_line = current_line;
+  state.current_token = current_token;
 
   // Set up the tokenizer to parse the token.
-  stream = new std::stringstream((const std::string &)current);
-  remaining = "";
+  state.code.clear();
+  state.code.str((const std::string &)current);
+  stream = &state.code;
+  remaining.clear();
   current_line = current.position();
   current_token = current.position();
   current_line.rewind(); // Backup the line position by one.
@@ -409,18 +423,15 @@ void meat::grinder::Tokenizer::push() {
  *********************************/
 
 void meat::grinder::Tokenizer::pop() {
-  if (not states.empty()) {
-    delete stream;
-
+  if (depth > 0) {
     // Restore the state of the tokenizer.
-    tokens = states.top().tokens;
-    remaining = states.top().remaining;
-    stream = states.top().stream;
-    current_line = states.top().current_line;
-    current_token = states.top().current_token;
-
-    // Pop it from the states stack.
-    states.pop();
+    stack_s &state = states[--depth];
+    tokens.swap(state.tokens);
+    state.tokens.clear();
+    remaining.swap(state.remaining);
+    stream = state.stream;
+    current_line = state.current_line;
+    current_token = state.current_token;
   }
 }
 
@@ -606,7 +617,11 @@ void meat::grinder::Tokenizer::parse_line(const std::string &line,
   size_t t_begin = 0;
   size_t t_end = 0;
   bool command_done = false;
-  std::string command = remaining + line;
+
+  // Only copy the line if it continues the remains of the last one.
+  std::string joined;
+  if (not remaining.empty()) joined = remaining + line;
+  const std::string &command = (remaining.empty() ? line : joined);
 
   complete = true;
 
@@ -809,22 +824,24 @@ void meat::grinder::Tokenizer::get_next_line() {
     }
 #endif // TESTING
 
+  std::string line;
+
   while (!stream->eof()) {
     // Read a line from the file.
-    std::string line;
-
+    line.clear();
     get_line(line);
 
     if (cook_lines) {
       // Just skip over comments.
-      if (line[line.find_first_not_of(" \n\r\t")] == '#')
+      std::size_t first = line.find_first_not_of(" \n\r\t");
+      if (first != line.npos and line[first] == '#')
         continue;
 
       // Trim any trailing white space
       line.erase(line.find_last_not_of(" \t") + 1);
 
       // If the line ends with a "\", then we append the next line to it.
-      if (line[line.length() - 1] == '\\') {
+      if (not line.empty() and line[line.length() - 1] == '\\') {
         line.erase(line.length() - 1);
         cont_line = true;
       } else
@@ -834,12 +851,14 @@ void meat::grinder::Tokenizer::get_next_line() {
        * command.
        */
       if (!line.empty()) {
-        parse_line(line + '\n');
+        line += '\n';
+        parse_line(line);
       } else {
         continue;
       }
     } else { // not cook_lines
-      parse_line(line + '\n');
+      line += '\n';
+      parse_line(line);
     }
 
     if (complete) return;
@@ -103,6 +103,10 @@ namespace meat {
        */
       Token(const Token &other);
 
+      /** Moves the token's text rather than copying it.
+       */
+      Token(Token &&other);
+
       /** Destructor.
        */
       virtual ~Token() throw();
@@ -261,14 +265,20 @@ namespace meat {
       bool cook_lines;
       bool cont_line;
 
+      /*  The saved states are kept when they're popped, along with the
+       * stream for the token pushed over them, so pushing tokens reuses
+       * them rather than allocating new ones.
+       */
       struct stack_s {
         std::deque<Token> tokens;
         std::string remaining;
         std::istream *stream;
         Location current_line;
         Location current_token;
+        std::istringstream code;
       };
-      std::stack<stack_s> states;
+      std::deque<stack_s> states;
+      std::size_t depth;
     };
 
     /** Base class for creating language structures.
@@ -438,11 +448,11 @@ namespace meat {
     private:
       Library *library;
       uint16_t cpp_bytecode;
-      uint8_t m_count;
-      uint8_t cm_count;
+      uint16_t m_count;
+      uint16_t cm_count;
 
-      uint8_t method_count() const;
-      uint8_t class_method_count() const;
+      uint16_t method_count() const;
+      uint16_t class_method_count() const;
       uint8_t obj_property(const std::string &name);
       uint8_t cls_property(const std::string &name);
       int16_t have_obj_property(const std::string &name) const;
@@ -492,6 +502,7 @@ namespace meat {
       /** Reference to the class that contains the method */
       Class *cb;
       ast::Block *astree;
+      ast::Arena *arena;    // Holds the syntax tree while compiling.
 
       bool _is_cpp;
       std::vector<std::uint8_t> bytecode;
@@ -203,7 +203,7 @@ meat::Reference meat::grinder::Interpreter::message() {
         parameters.push_back(new meat::Text(tokens[0]));
         tokens.next();
       } else if (tokens.expect(Token::INTEGER)) {
-        parameters.push_back(new meat::Value((std::int32_t)tokens[0]));
+        parameters.push_back(meat::Integer((std::int32_t)tokens[0]));
         tokens.next();
       } else if (tokens.expect(Token::NUMBER)) {
         parameters.push_back(new meat::Value((double)tokens[0]));
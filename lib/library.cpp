@@ -113,7 +113,7 @@ public:
 
   VtableBuilder() {}
 
-  void set(const struct _vtable_entry_s *table, uint8_t count) {
+  void set(const struct _vtable_entry_s *table, uint16_t count) {
     static Ty foo;
     vtable.clear();
     for (unsigned int c = 0; c < count; ++c) {
@@ -135,7 +135,7 @@ public:
     vtable.push_back(entry);
   }
 
-  std::uint8_t size() { return vtable.size(); }
+  std::uint16_t size() { return vtable.size(); }
 
   const_iterator begin() const { return vtable.begin(); }
   iterator begin() { return vtable.begin(); }
@@ -388,7 +388,7 @@ Reference grinder::Library::message() {
         parameters.push_back(new meat::Text((const std::string &)tokens[0]));
         tokens.next();
       } else if (tokens.expect(Token::INTEGER)) {
-        parameters.push_back(new meat::Value((std::int32_t)tokens[0]));
+        parameters.push_back(meat::Integer((std::int32_t)tokens[0]));
         tokens.next();
       } else if (tokens.expect(Token::NUMBER)) {
         parameters.push_back(new meat::Value((double)tokens[0]));
@@ -447,7 +447,7 @@ extern "C" {
 void grinder::Library::write_mlib(std::ostream &out) {
   mlib_header_t header = {
     {'M', 'L', 'I', 'B'},
-    1, 0, 0, 0
+    1, 1, 0, 0
   };
 
   // Add the application class hash ID if the library is executable.
@@ -700,7 +700,7 @@ void grinder::Class::create_class() const {
 
   std::vector<uint8_t> bytecode;
 
-  uint8_t vt_size;
+  uint16_t vt_size;
   const vtable_entry_t *vt;
   VtableBuilder<struct _vtable_entry_s> vtable;
   VtableBuilder<struct _vtable_entry_s>::iterator vtable_it;
@@ -722,6 +722,7 @@ void grinder::Class::create_class() const {
     entry.flags = VTM_BYTECODE;
     entry.locals = cast<grinder::Method>(method.second).locals();
     entry.method.offset = offset;
+    entry.invocations = 0;
 #ifdef DEBUG
     std::cout << "VTABLE: method " << cast<const Text>(method.first)
               << " bytecode @ " << offset << std::endl;
@@ -750,6 +751,7 @@ void grinder::Class::create_class() const {
     entry.flags = VTM_BYTECODE;
     entry.locals = cast<grinder::Method>(method.second).locals();
     entry.method.offset = offset;
+    entry.invocations = 0;
 #ifdef DEBUG
     std::cout << "VTABLE: class method " << cast<const Text>(method.first)
               << " bytecode @ " << offset << std::endl;
@@ -835,7 +837,7 @@ void grinder::Class::cpp_methods(std::ostream &out) {
     out << "\n";
   }
 
-  uint8_t vt_size;
+  uint16_t vt_size;
   const vtable_entry_t *vt;
   VtableBuilder<struct _c_vtable_entry_s> vtable;
 
@@ -898,7 +900,7 @@ void grinder::Class::cpp_methods(std::ostream &out) {
 
       out << "  {" << entry.str_hash << ", " << entry.str_class_hash
           << ", " << entry.flags << ", " << ::to_string(entry.locals)
-          << ", {(meat::method_ptr_t)" << entry.func_name << "}}";
+          << ", {(meat::method_ptr_t)" << entry.func_name << "}, 0}";
     }
     out << "\n};\n\n";
   }
@@ -966,7 +968,7 @@ void grinder::Class::cpp_methods(std::ostream &out) {
 
       out << "  {" << entry.str_hash << ", " << entry.str_class_hash
           << ", " << entry.flags << ", " << ::to_string(entry.locals)
-          << ", {(meat::method_ptr_t)" << entry.func_name + "}}";
+          << ", {(meat::method_ptr_t)" << entry.func_name + "}, 0}";
     }
     out << "\n};\n\n";
   }
@@ -1231,7 +1233,7 @@ void grinder::Class::method_def(bool is_native) {
  * meat::grinder::Class::method_count *
  **************************************/
 
-uint8_t grinder::Class::method_count() const {
+uint16_t grinder::Class::method_count() const {
   if (m_count == 0) {
     const Index &methods = cast<const Index>(objectMethods);
     return methods.size();
@@ -1243,7 +1245,7 @@ uint8_t grinder::Class::method_count() const {
  * meat::Grinder::Class::class_method_count *
  ********************************************/
 
-uint8_t grinder::Class::class_method_count() const {
+uint16_t grinder::Class::class_method_count() const {
   if (cm_count == 0) {
     const Index &methods = cast<const Index>(classMethods);
     return methods.size();
@@ -1268,14 +1270,14 @@ uint8_t grinder::Class::class_method_count() const {
  *********************************/
 
 grinder::Method::Method(Reference klass, uint8_t properties)
-  : Object(klass, properties), cb(NULL), _is_cpp(false) {
+  : Object(klass, properties), cb(NULL), arena(NULL), _is_cpp(false) {
   this->property(0) = new List(); // Name
   this->property(1) = new List(); // Parameters
 }
 
 grinder::Method::Method(Class &cb, bool is_cpp)
   : Object(meat::Class::resolve("Grinder.Method"), 3), cb(&cb),
-    _is_cpp(is_cpp) {
+    arena(NULL), _is_cpp(is_cpp) {
   this->property(0) = new List(); // Name
   this->property(1) = new List(); // Parameters
 }
@@ -1290,6 +1292,12 @@ void grinder::Method::compile() {
     List &properties = cast<List>(cb->property(2));
     List &cls_properties = cast<List>(cb->property(3));
 
+    /*  All the nodes of the method's syntax tree are kept in the arena,
+     * and freed together when the method has been compiled.
+     */
+    ast::Arena nodes;
+    arena = &nodes;
+
     ast::Method method(properties,
                        cast<meat::Class>(super).obj_properties(),
                        cls_properties, 0);
@@ -1310,6 +1318,7 @@ void grinder::Method::compile() {
     method.append_bytecode(bytecode);
 
     astree = NULL;
+    arena = NULL;
   }
 }
 
@@ -1464,9 +1473,9 @@ grinder::ast::Message *grinder::Method::message() {
   if (tokens.expect(Token::WORD)) {
     if (tokens[0] == "super") {
       super = true;
-      obj = new grinder::ast::Identifier("self");
+      obj = new (*arena) grinder::ast::Identifier("self");
     } else
-      obj = new grinder::ast::Identifier(tokens[0]);
+      obj = new (*arena) grinder::ast::Identifier(tokens[0]);
     tokens.next();
   } else if (tokens.expect(Token::LITRL_STRING) or
              tokens.expect(Token::SUBST_STRING) or
@@ -1483,7 +1492,7 @@ grinder::ast::Message *grinder::Method::message() {
   }
 
   // Create the new message ast branch.
-  ast::Message *mesg = new ast::Message(obj);
+  ast::Message *mesg = new (*arena) ast::Message(obj);
 
   std::string method_name;
   for (unsigned int c = 0; not tokens.expect(Token::EOL); ++c) {
@@ -1494,7 +1503,7 @@ grinder::ast::Message *grinder::Method::message() {
     } else {
       // Parameters
       if (tokens.expect(Token::WORD)) {
-        mesg->add_param(new meat::grinder::ast::Identifier(tokens[0]));
+        mesg->add_param(new (*arena) ast::Identifier(tokens[0]));
         tokens.next();
       } else if (tokens.expect(Token::LITRL_STRING) or
                  tokens.expect(Token::SUBST_STRING) or
@@ -1529,7 +1538,7 @@ grinder::ast::Message *grinder::Method::message() {
  *************************************/
 
 grinder::ast::Assignment *grinder::Method::assignment() {
-  ast::Identifier *dest = new ast::Identifier(tokens[0]);
+  ast::Identifier *dest = new (*arena) ast::Identifier(tokens[0]);
   ast::Node *src = NULL;
 
 #ifdef DEBUG
@@ -1542,17 +1551,17 @@ grinder::ast::Assignment *grinder::Method::assignment() {
 
   // Get the value part of the assignment.
   if (tokens.expect(Token::WORD)) {
-    src = new ast::Identifier(tokens[0]);
+    src = new (*arena) ast::Identifier(tokens[0]);
     tokens.next();
   } else if (tokens.expect(Token::LITRL_STRING) or
              tokens.expect(Token::SUBST_STRING)) {
-    src = new ast::Constant((std::string)tokens[0]);
+    src = new (*arena) ast::Constant((std::string)tokens[0]);
     tokens.next();
   } else if (tokens.expect(Token::INTEGER)) {
-    src = new ast::Constant((std::int32_t)tokens[0]);
+    src = new (*arena) ast::Constant((std::int32_t)tokens[0]);
     tokens.next();
   } else if (tokens.expect(Token::NUMBER)) {
-    src = new ast::Constant((double)tokens[0]);
+    src = new (*arena) ast::Constant((double)tokens[0]);
     tokens.next();
   } else if (tokens.expect(Token::COMMAND)) {
     tokens.push();
@@ -1565,7 +1574,7 @@ grinder::ast::Assignment *grinder::Method::assignment() {
 
   tokens.permit(Token::EOL);
 
-  return new ast::Assignment(dest, src);
+  return new (*arena) ast::Assignment(dest, src);
 }
 
 /********************************
@@ -1573,7 +1582,7 @@ grinder::ast::Assignment *grinder::Method::assignment() {
  ********************************/
 
 grinder::ast::ContextBlock *grinder::Method::block() {
-  ast::ContextBlock *new_block = new ast::ContextBlock();
+  ast::ContextBlock *new_block = new (*arena) ast::ContextBlock();
   ast::Block *save = astree;
   new_block->scope(save);
   astree = new_block;
@@ -1613,15 +1622,15 @@ grinder::ast::Constant *grinder::Method::constant() {
       tokens.expect(Token::SUBST_STRING)) {
     std::string value = (const std::string &)tokens[0];
     tokens.next();
-    return new grinder::ast::Constant(value);
+    return new (*arena) grinder::ast::Constant(value);
   } else if (tokens.expect(Token::INTEGER)) {
     std::int32_t value = (std::int32_t)tokens[0];
     tokens.next();
-    return new grinder::ast::Constant(value);
+    return new (*arena) grinder::ast::Constant(value);
   } else if (tokens.expect(Token::NUMBER)) {
     double value = (double)tokens[0];
     tokens.next();
-    return new grinder::ast::Constant(value);
+    return new (*arena) grinder::ast::Constant(value);
   } else {
     throw Exception("Was expecting string constant");
   }
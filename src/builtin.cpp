@@ -64,21 +64,21 @@ using namespace meat;
  */
 
 static meat::vtable_entry_t ClassMethods[] = {
-  {0x00000782, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x000007a0, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x00019850, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x00368f3a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x00379f78, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x20be875b, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x24ab71da, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x331152ee, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x34003578, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x39a68c12, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x39a6a1d2, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x48dbf560, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x6b2d9a7a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x7a8e569a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x7b840562, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}}
+  {0x00000782, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x000007a0, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x00019850, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x00368f3a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x00379f78, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x20be875b, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x24ab71da, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x331152ee, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x34003578, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x39a68c12, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x39a6a1d2, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x48dbf560, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x6b2d9a7a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x7a8e569a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x7b840562, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0}
 };
 
 // class method forEach:do:
@@ -198,25 +198,25 @@ static Reference Class_cm_weakReference(Reference context) {
   }
 
 static meat::vtable_entry_t ClassCMethods[] = {
-  {0x00000782, 0x03e2b958, VTM_BYTECODE, 6, {(meat::method_ptr_t)0}},
-  {0x000007a0, 0x03e2b958, VTM_BYTECODE, 6, {(meat::method_ptr_t)18}},
-  {0x00019850, 0x03e2b958, VTM_NATIVE  , 1, {(meat::method_ptr_t)Class_cm_is_}},
-  {0x00337a8b, 0x03e2b958, VTM_NATIVE  , 0, {(meat::method_ptr_t)Class_cm_name}},
-  {0x00368f3a, 0x03e2b958, VTM_BYTECODE, 5, {(meat::method_ptr_t)130}},
-  {0x018b0a25, 0x03e2b958, VTM_NATIVE  , 2, {(meat::method_ptr_t)Class_cm_forEach_do_}},
-  {0x068b6f7b, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x181f14c4, 0x03e2b958, VTM_NATIVE  , 0, {(meat::method_ptr_t)Class_cm_superClass}},
-  {0x20be875b, 0x03e2b958, VTM_NATIVE  , 0, {(meat::method_ptr_t)Class_cm_weakReference}},
-  {0x24ab71da, 0x03e2b958, VTM_NATIVE  , 0, {(meat::method_ptr_t)Class_cm_normalReference}},
-  {0x34003578, 0x03e2b958, VTM_BYTECODE, 4, {(meat::method_ptr_t)36}},
-  {0x39a68c12, 0x03e2b958, VTM_NATIVE  , 1, {(meat::method_ptr_t)Class_cm_isNot_}},
-  {0x39a6a1d2, 0x03e2b958, VTM_BYTECODE, 6, {(meat::method_ptr_t)60}},
-  {0x54aa30e6, 0x03e2b958, VTM_NATIVE  , 0, {(meat::method_ptr_t)Class_cm_newObject}},
-  {0x58a69b58, 0x03e2b958, VTM_NATIVE  , 2, {(meat::method_ptr_t)Class_cm_subclass_as_}},
-  {0x6b2d9a7a, 0x03e2b958, VTM_BYTECODE, 6, {(meat::method_ptr_t)83}},
-  {0x7a8e569a, 0x03e2b958, VTM_BYTECODE, 6, {(meat::method_ptr_t)37}},
-  {0x7b840562, 0x03e2b958, VTM_BYTECODE, 7, {(meat::method_ptr_t)106}},
-  {0x7d180801, 0x03e2b958, VTM_NATIVE  , 0, {(meat::method_ptr_t)Class_cm_isWeakReference}}
+  {0x00000782, 0x03e2b958, VTM_BYTECODE, 6, {(meat::method_ptr_t)0}, 0},
+  {0x000007a0, 0x03e2b958, VTM_BYTECODE, 6, {(meat::method_ptr_t)18}, 0},
+  {0x00019850, 0x03e2b958, VTM_NATIVE  , 1, {(meat::method_ptr_t)Class_cm_is_}, 0},
+  {0x00337a8b, 0x03e2b958, VTM_NATIVE  , 0, {(meat::method_ptr_t)Class_cm_name}, 0},
+  {0x00368f3a, 0x03e2b958, VTM_BYTECODE, 5, {(meat::method_ptr_t)130}, 0},
+  {0x018b0a25, 0x03e2b958, VTM_NATIVE  , 2, {(meat::method_ptr_t)Class_cm_forEach_do_}, 0},
+  {0x068b6f7b, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x181f14c4, 0x03e2b958, VTM_NATIVE  , 0, {(meat::method_ptr_t)Class_cm_superClass}, 0},
+  {0x20be875b, 0x03e2b958, VTM_NATIVE  , 0, {(meat::method_ptr_t)Class_cm_weakReference}, 0},
+  {0x24ab71da, 0x03e2b958, VTM_NATIVE  , 0, {(meat::method_ptr_t)Class_cm_normalReference}, 0},
+  {0x34003578, 0x03e2b958, VTM_BYTECODE, 4, {(meat::method_ptr_t)36}, 0},
+  {0x39a68c12, 0x03e2b958, VTM_NATIVE  , 1, {(meat::method_ptr_t)Class_cm_isNot_}, 0},
+  {0x39a6a1d2, 0x03e2b958, VTM_BYTECODE, 6, {(meat::method_ptr_t)60}, 0},
+  {0x54aa30e6, 0x03e2b958, VTM_NATIVE  , 0, {(meat::method_ptr_t)Class_cm_newObject}, 0},
+  {0x58a69b58, 0x03e2b958, VTM_NATIVE  , 2, {(meat::method_ptr_t)Class_cm_subclass_as_}, 0},
+  {0x6b2d9a7a, 0x03e2b958, VTM_BYTECODE, 6, {(meat::method_ptr_t)83}, 0},
+  {0x7a8e569a, 0x03e2b958, VTM_BYTECODE, 6, {(meat::method_ptr_t)37}, 0},
+  {0x7b840562, 0x03e2b958, VTM_BYTECODE, 7, {(meat::method_ptr_t)106}, 0},
+  {0x7d180801, 0x03e2b958, VTM_NATIVE  , 0, {(meat::method_ptr_t)Class_cm_isWeakReference}, 0}
 };
 
 static std::uint8_t ClassBytecode[] = {
@@ -242,7 +242,7 @@ static Reference Object_constructor(
   Reference &klass,
   std::uint8_t properties) {
 
-    return new meat::Object(klass, properties);
+    return new (properties) meat::Object(klass, properties);
   
 }
 
@@ -270,7 +270,7 @@ static Reference Object_om_isType_(Reference context) {
   Reference klass = cast<Context>(context).klass();
   Reference type = cast<Context>(context).parameter(0);
 
-    return Boolean(self->is_type(type));
+    return Boolean(is_type(self, type));
   }
 
 // method isWeakReference
@@ -294,7 +294,7 @@ static Reference Object_om_type(Reference context) {
   Reference self = cast<Context>(context).self();
   Reference klass = cast<Context>(context).klass();
 
-    return self->type();
+    return type_of(self);
   }
 
 // method weakReference
@@ -306,39 +306,39 @@ static Reference Object_om_weakReference(Reference context) {
   }
 
 static meat::vtable_entry_t ObjectMethods[] = {
-  {0x00000782, 0x0c658f60, VTM_BYTECODE, 6, {(meat::method_ptr_t)0}},
-  {0x000007a0, 0x0c658f60, VTM_BYTECODE, 6, {(meat::method_ptr_t)18}},
-  {0x00019850, 0x0c658f60, VTM_NATIVE  , 1, {(meat::method_ptr_t)Object_om_is_}},
-  {0x00368f3a, 0x0c658f60, VTM_NATIVE  , 0, {(meat::method_ptr_t)Object_om_type}},
-  {0x00379f78, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x20be875b, 0x0c658f60, VTM_NATIVE  , 0, {(meat::method_ptr_t)Object_om_weakReference}},
-  {0x24ab71da, 0x0c658f60, VTM_NATIVE  , 0, {(meat::method_ptr_t)Object_om_normalReference}},
-  {0x331152ee, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x34003578, 0x0c658f60, VTM_BYTECODE, 4, {(meat::method_ptr_t)36}},
-  {0x39a68c12, 0x0c658f60, VTM_NATIVE  , 1, {(meat::method_ptr_t)Object_om_isNot_}},
-  {0x39a6a1d2, 0x0c658f60, VTM_BYTECODE, 6, {(meat::method_ptr_t)60}},
-  {0x48dbf560, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x6b2d9a7a, 0x0c658f60, VTM_BYTECODE, 6, {(meat::method_ptr_t)83}},
-  {0x7a8e569a, 0x0c658f60, VTM_BYTECODE, 6, {(meat::method_ptr_t)37}},
-  {0x7b840562, 0x0c658f60, VTM_NATIVE  , 1, {(meat::method_ptr_t)Object_om_isType_}},
-  {0x7d180801, 0x0c658f60, VTM_NATIVE  , 0, {(meat::method_ptr_t)Object_om_isWeakReference}}
+  {0x00000782, 0x0c658f60, VTM_BYTECODE, 6, {(meat::method_ptr_t)0}, 0},
+  {0x000007a0, 0x0c658f60, VTM_BYTECODE, 6, {(meat::method_ptr_t)18}, 0},
+  {0x00019850, 0x0c658f60, VTM_NATIVE  , 1, {(meat::method_ptr_t)Object_om_is_}, 0},
+  {0x00368f3a, 0x0c658f60, VTM_NATIVE  , 0, {(meat::method_ptr_t)Object_om_type}, 0},
+  {0x00379f78, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x20be875b, 0x0c658f60, VTM_NATIVE  , 0, {(meat::method_ptr_t)Object_om_weakReference}, 0},
+  {0x24ab71da, 0x0c658f60, VTM_NATIVE  , 0, {(meat::method_ptr_t)Object_om_normalReference}, 0},
+  {0x331152ee, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x34003578, 0x0c658f60, VTM_BYTECODE, 4, {(meat::method_ptr_t)36}, 0},
+  {0x39a68c12, 0x0c658f60, VTM_NATIVE  , 1, {(meat::method_ptr_t)Object_om_isNot_}, 0},
+  {0x39a6a1d2, 0x0c658f60, VTM_BYTECODE, 6, {(meat::method_ptr_t)60}, 0},
+  {0x48dbf560, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x6b2d9a7a, 0x0c658f60, VTM_BYTECODE, 6, {(meat::method_ptr_t)83}, 0},
+  {0x7a8e569a, 0x0c658f60, VTM_BYTECODE, 6, {(meat::method_ptr_t)37}, 0},
+  {0x7b840562, 0x0c658f60, VTM_NATIVE  , 1, {(meat::method_ptr_t)Object_om_isType_}, 0},
+  {0x7d180801, 0x0c658f60, VTM_NATIVE  , 0, {(meat::method_ptr_t)Object_om_isWeakReference}, 0}
 };
 
 static meat::vtable_entry_t ObjectCMethods[] = {
-  {0x00000782, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x000007a0, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x00019850, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x00368f3a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x068b6f7b, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x20be875b, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x24ab71da, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x39a68c12, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x39a6a1d2, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x54aa30e6, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x6b2d9a7a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x7a8e569a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x7b840562, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x7d180801, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}}
+  {0x00000782, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x000007a0, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x00019850, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x00368f3a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x068b6f7b, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x20be875b, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x24ab71da, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x39a68c12, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x39a6a1d2, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x54aa30e6, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x6b2d9a7a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x7a8e569a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x7b840562, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x7d180801, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0}
 };
 
 static std::uint8_t ObjectBytecode[] = {
@@ -361,7 +361,7 @@ static Reference Context_constructor(
   Reference &klass,
   std::uint8_t properties) {
 
-    return new meat::Context(klass, properties);
+    return new (properties) meat::Context(klass, properties);
   
 }
 
@@ -379,7 +379,7 @@ static Reference Context_om_localVariables(Reference context) {
   Reference self = cast<Context>(context).self();
   Reference klass = cast<Context>(context).klass();
 
-    return new meat::Value(cast<Context>(self).locals() - 4);
+    return meat::Integer(cast<Context>(self).locals() - 4);
   }
 
 // method messenger
@@ -387,7 +387,10 @@ static Reference Context_om_messenger(Reference context) {
   Reference self = cast<Context>(context).self();
   Reference klass = cast<Context>(context).klass();
 
-    return cast<Context>(self).messenger();
+    Reference messenger = cast<Context>(self).messenger();
+    if (not messenger.is_null() and messenger != null)
+      cast<Context>(messenger).promote();
+    return messenger;
   }
 
 // method repeat:
@@ -396,22 +399,17 @@ static Reference Context_om_repeat_(Reference context) {
   Reference klass = cast<Context>(context).klass();
   Reference block = cast<Context>(context).parameter(0);
 
-    cast<Context>(block).messenger(context);
-
-    for (;;) {
-      cast<BlockContext>(block).set_break_trap();
-      cast<BlockContext>(block).set_continue_trap();
-      execute(block);
-
-      if (cast<BlockContext>(block).break_called() or
-          cast<Context>(block).is_done())
-        break;
-
+    Context &ctx = cast<Context>(context);
+    if (ctx.step() > 0) {
+      bool stop = (cast<BlockContext>(block).break_called() or
+                   cast<Context>(block).is_done());
       cast<BlockContext>(block).reset();
+      if (stop) return null;
     }
-    cast<BlockContext>(block).reset();
 
-    return null;
+    cast<BlockContext>(block).set_break_trap();
+    cast<BlockContext>(block).set_continue_trap();
+    return ctx.invoke(block);
   }
 
 // method return
@@ -457,49 +455,49 @@ static Reference Context_om_setLocal_to_(Reference context) {
   }
 
 static meat::vtable_entry_t ContextMethods[] = {
-  {0x00000782, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x000007a0, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x00019850, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x00368f3a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x00379f78, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x059a58ff, 0x1befcdac, VTM_BYTECODE, 4, {(meat::method_ptr_t)0}},
-  {0x20be875b, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x23add62f, 0x1befcdac, VTM_NATIVE  , 1, {(meat::method_ptr_t)Context_om_getLocal_}},
-  {0x24ab71da, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x2a67696c, 0x1befcdac, VTM_NATIVE  , 0, {(meat::method_ptr_t)Context_om_messenger}},
-  {0x331152ee, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x34003578, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x39a68c12, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x39a6a1d2, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x4139862f, 0x1befcdac, VTM_NATIVE  , 1, {(meat::method_ptr_t)Context_om_repeat_}},
-  {0x4179693a, 0x1befcdac, VTM_NATIVE  , 1, {(meat::method_ptr_t)Context_om_return_}},
-  {0x47206ce4, 0x1befcdac, VTM_NATIVE  , 0, {(meat::method_ptr_t)Context_om_localVariables}},
-  {0x484e3d31, 0x1befcdac, VTM_NATIVE  , 0, {(meat::method_ptr_t)Context_om_return}},
-  {0x48c473ea, 0x1befcdac, VTM_NATIVE  , 1, {(meat::method_ptr_t)Context_om_returnTo_}},
-  {0x48dbf560, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x5e3131ca, 0x1befcdac, VTM_BYTECODE, 4, {(meat::method_ptr_t)1}},
-  {0x675bde74, 0x1befcdac, VTM_NATIVE  , 2, {(meat::method_ptr_t)Context_om_setLocal_to_}},
-  {0x6b2d9a7a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x7a8e569a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x7b840562, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x7d180801, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}}
+  {0x00000782, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x000007a0, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x00019850, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x00368f3a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x00379f78, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x059a58ff, 0x1befcdac, VTM_BYTECODE, 4, {(meat::method_ptr_t)0}, 0},
+  {0x20be875b, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x23add62f, 0x1befcdac, VTM_NATIVE  , 1, {(meat::method_ptr_t)Context_om_getLocal_}, 0},
+  {0x24ab71da, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x2a67696c, 0x1befcdac, VTM_NATIVE  , 0, {(meat::method_ptr_t)Context_om_messenger}, 0},
+  {0x331152ee, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x34003578, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x39a68c12, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x39a6a1d2, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x4139862f, 0x1befcdac, VTM_NATIVE  , 1, {(meat::method_ptr_t)Context_om_repeat_}, 0},
+  {0x4179693a, 0x1befcdac, VTM_NATIVE  , 1, {(meat::method_ptr_t)Context_om_return_}, 0},
+  {0x47206ce4, 0x1befcdac, VTM_NATIVE  , 0, {(meat::method_ptr_t)Context_om_localVariables}, 0},
+  {0x484e3d31, 0x1befcdac, VTM_NATIVE  , 0, {(meat::method_ptr_t)Context_om_return}, 0},
+  {0x48c473ea, 0x1befcdac, VTM_NATIVE  , 1, {(meat::method_ptr_t)Context_om_returnTo_}, 0},
+  {0x48dbf560, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x5e3131ca, 0x1befcdac, VTM_BYTECODE, 4, {(meat::method_ptr_t)1}, 0},
+  {0x675bde74, 0x1befcdac, VTM_NATIVE  , 2, {(meat::method_ptr_t)Context_om_setLocal_to_}, 0},
+  {0x6b2d9a7a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x7a8e569a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x7b840562, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x7d180801, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0}
 };
 
 static meat::vtable_entry_t ContextCMethods[] = {
-  {0x00000782, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x000007a0, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x00019850, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x00368f3a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x068b6f7b, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x20be875b, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x24ab71da, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x39a68c12, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x39a6a1d2, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x54aa30e6, 0x1befcdac, VTM_BYTECODE, 7, {(meat::method_ptr_t)2}},
-  {0x6b2d9a7a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x7a8e569a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x7b840562, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x7d180801, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}}
+  {0x00000782, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x000007a0, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x00019850, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x00368f3a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x068b6f7b, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x20be875b, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x24ab71da, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x39a68c12, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x39a6a1d2, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x54aa30e6, 0x1befcdac, VTM_BYTECODE, 7, {(meat::method_ptr_t)2}, 0},
+  {0x6b2d9a7a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x7a8e569a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x7b840562, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x7d180801, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0}
 };
 
 static std::uint8_t ContextBytecode[] = {
@@ -548,9 +546,11 @@ static Reference BlockContext_om_execute(Reference context) {
   Reference self = cast<Context>(context).self();
   Reference klass = cast<Context>(context).klass();
 
-    cast<BlockContext>(self).messenger(context);
-    cast<BlockContext>(self).reset();
-    execute(self);
+    Context &ctx = cast<Context>(context);
+    if (ctx.step() == 0) {
+      cast<BlockContext>(self).reset();
+      return ctx.invoke(self);
+    }
 
     return null;
   }
@@ -661,54 +661,54 @@ static Reference BlockContext_om_return_(Reference context) {
   }
 
 static meat::vtable_entry_t BlockContextMethods[] = {
-  {0x00000782, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x000007a0, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x00019850, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x00368f3a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x00379f78, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x059a58ff, 0x46ba8a20, VTM_NATIVE  , 0, {(meat::method_ptr_t)BlockContext_om_break}},
-  {0x06761d4f, 0x46ba8a20, VTM_NATIVE  , 0, {(meat::method_ptr_t)BlockContext_om_reset}},
-  {0x20be875b, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x23add62f, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x24ab71da, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x290a0d52, 0x46ba8a20, VTM_NATIVE  , 1, {(meat::method_ptr_t)BlockContext_om_executeOnContinue_}},
-  {0x2a67696c, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x3158f7a0, 0x46ba8a20, VTM_NATIVE  , 0, {(meat::method_ptr_t)BlockContext_om_execute}},
-  {0x331152ee, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x34003578, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x39a68c12, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x39a6a1d2, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x4139862f, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x4179693a, 0x46ba8a20, VTM_NATIVE  , 1, {(meat::method_ptr_t)BlockContext_om_return_}},
-  {0x47206ce4, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x484e3d31, 0x46ba8a20, VTM_NATIVE  , 0, {(meat::method_ptr_t)BlockContext_om_return}},
-  {0x48c473ea, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x48dbf560, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x5a7f66e9, 0x46ba8a20, VTM_NATIVE  , 1, {(meat::method_ptr_t)BlockContext_om_executeOnBreak_}},
-  {0x5e3131ca, 0x46ba8a20, VTM_NATIVE  , 0, {(meat::method_ptr_t)BlockContext_om_continue}},
-  {0x675bde74, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x6b2d9a7a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x71828805, 0x46ba8a20, VTM_NATIVE  , 2, {(meat::method_ptr_t)BlockContext_om_executeOnBreak_onContinue_}},
-  {0x7a8e569a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x7b840562, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x7d180801, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}}
+  {0x00000782, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x000007a0, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x00019850, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x00368f3a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x00379f78, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x059a58ff, 0x46ba8a20, VTM_NATIVE  , 0, {(meat::method_ptr_t)BlockContext_om_break}, 0},
+  {0x06761d4f, 0x46ba8a20, VTM_NATIVE  , 0, {(meat::method_ptr_t)BlockContext_om_reset}, 0},
+  {0x20be875b, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x23add62f, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x24ab71da, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x290a0d52, 0x46ba8a20, VTM_NATIVE  , 1, {(meat::method_ptr_t)BlockContext_om_executeOnContinue_}, 0},
+  {0x2a67696c, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x3158f7a0, 0x46ba8a20, VTM_NATIVE  , 0, {(meat::method_ptr_t)BlockContext_om_execute}, 0},
+  {0x331152ee, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x34003578, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x39a68c12, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x39a6a1d2, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x4139862f, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x4179693a, 0x46ba8a20, VTM_NATIVE  , 1, {(meat::method_ptr_t)BlockContext_om_return_}, 0},
+  {0x47206ce4, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x484e3d31, 0x46ba8a20, VTM_NATIVE  , 0, {(meat::method_ptr_t)BlockContext_om_return}, 0},
+  {0x48c473ea, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x48dbf560, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x5a7f66e9, 0x46ba8a20, VTM_NATIVE  , 1, {(meat::method_ptr_t)BlockContext_om_executeOnBreak_}, 0},
+  {0x5e3131ca, 0x46ba8a20, VTM_NATIVE  , 0, {(meat::method_ptr_t)BlockContext_om_continue}, 0},
+  {0x675bde74, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x6b2d9a7a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x71828805, 0x46ba8a20, VTM_NATIVE  , 2, {(meat::method_ptr_t)BlockContext_om_executeOnBreak_onContinue_}, 0},
+  {0x7a8e569a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x7b840562, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x7d180801, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0}
 };
 
 static meat::vtable_entry_t BlockContextCMethods[] = {
-  {0x00000782, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x000007a0, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x00019850, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x00368f3a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x068b6f7b, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x20be875b, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x24ab71da, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x39a68c12, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x39a6a1d2, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x54aa30e6, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x6b2d9a7a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x7a8e569a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x7b840562, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x7d180801, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}}
+  {0x00000782, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x000007a0, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x00019850, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x00368f3a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x068b6f7b, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x20be875b, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x24ab71da, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x39a68c12, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x39a6a1d2, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x54aa30e6, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x6b2d9a7a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x7a8e569a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x7b840562, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x7d180801, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0}
 };
 
 /******************************************************************************
@@ -718,41 +718,41 @@ static meat::vtable_entry_t BlockContextCMethods[] = {
 #define nullObject (klass->property(0))
 
 static meat::vtable_entry_t NullMethods[] = {
-  {0x00000782, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x000007a0, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x00019850, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x00368f3a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x00379f78, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x20be875b, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x24ab71da, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x331152ee, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x34003578, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x39a68c12, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x39a6a1d2, 0x002539a7, VTM_BYTECODE, 6, {(meat::method_ptr_t)0}},
-  {0x4300a340, 0x002539a7, VTM_BYTECODE, 5, {(meat::method_ptr_t)23}},
-  {0x48dbf560, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x6b2d9a7a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x7a8e569a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x7b840562, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x7d180801, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}}
+  {0x00000782, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x000007a0, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x00019850, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x00368f3a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x00379f78, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x20be875b, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x24ab71da, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x331152ee, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x34003578, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x39a68c12, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x39a6a1d2, 0x002539a7, VTM_BYTECODE, 6, {(meat::method_ptr_t)0}, 0},
+  {0x4300a340, 0x002539a7, VTM_BYTECODE, 5, {(meat::method_ptr_t)23}, 0},
+  {0x48dbf560, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x6b2d9a7a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x7a8e569a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x7b840562, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x7d180801, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0}
 };
 
 static meat::vtable_entry_t NullCMethods[] = {
-  {0x00000782, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x000007a0, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x00019850, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x00368f3a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x068b6f7b, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x20be875b, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x24ab71da, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x39a68c12, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x39a6a1d2, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x54aa30e6, 0x002539a7, VTM_BYTECODE, 7, {(meat::method_ptr_t)35}},
-  {0x58a69b58, 0x002539a7, VTM_BYTECODE, 9, {(meat::method_ptr_t)102}},
-  {0x6b2d9a7a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x7a8e569a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x7b840562, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x7d180801, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}}
+  {0x00000782, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x000007a0, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x00019850, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x00368f3a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x068b6f7b, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x20be875b, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x24ab71da, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x39a68c12, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x39a6a1d2, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x54aa30e6, 0x002539a7, VTM_BYTECODE, 7, {(meat::method_ptr_t)35}, 0},
+  {0x58a69b58, 0x002539a7, VTM_BYTECODE, 9, {(meat::method_ptr_t)102}, 0},
+  {0x6b2d9a7a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x7a8e569a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x7b840562, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x7d180801, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0}
 };
 
 #undef nullObject
@@ -781,7 +781,7 @@ static Reference Exception_constructor(
   Reference &klass,
   std::uint8_t properties) {
 
-    return new meat::Exception(klass, properties);
+    return new (properties) meat::Exception(klass, properties);
   
 }
 
@@ -789,24 +789,24 @@ static Reference Exception_constructor(
 #define cntxt (self->property(1))
 
 static meat::vtable_entry_t ExceptionMethods[] = {
-  {0x00000782, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x000007a0, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x00019850, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x00368f3a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x00379f78, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x20be875b, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x24ab71da, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x331152ee, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x34003578, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x38b735d9, 0x4fc26166, VTM_BYTECODE, 5, {(meat::method_ptr_t)0}},
-  {0x38eb0035, 0x4fc26166, VTM_BYTECODE, 5, {(meat::method_ptr_t)12}},
-  {0x39a68c12, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x39a6a1d2, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x48dbf560, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x6b2d9a7a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x7a8e569a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x7b840562, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x7d180801, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}}
+  {0x00000782, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x000007a0, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x00019850, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x00368f3a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x00379f78, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x20be875b, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x24ab71da, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x331152ee, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x34003578, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x38b735d9, 0x4fc26166, VTM_BYTECODE, 5, {(meat::method_ptr_t)0}, 0},
+  {0x38eb0035, 0x4fc26166, VTM_BYTECODE, 5, {(meat::method_ptr_t)12}, 0},
+  {0x39a68c12, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x39a6a1d2, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x48dbf560, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x6b2d9a7a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x7a8e569a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x7b840562, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x7d180801, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0}
 };
 
 #undef mesg
@@ -856,15 +856,9 @@ static Reference Exception_cm_try_(Reference context) {
   Reference klass = cast<Context>(context).klass();
   Reference block = cast<Context>(context).parameter(0);
 
-    cast<Context>(block).messenger(context);
-
-    try {
-      execute(block);
-    } catch (meat::Exception &err) {
-      cast<BlockContext>(block).reset();
-    } catch (...) {
-      cast<BlockContext>(block).reset();
-    }
+    Context &ctx = cast<Context>(context);
+    if (ctx.step() == 0) return ctx.invoke(block, true);
+    if (ctx.caught() != null) cast<BlockContext>(block).reset();
 
     return null;
   }
@@ -876,12 +870,14 @@ static Reference Exception_cm_try_catch_(Reference context) {
   Reference try_block = cast<Context>(context).parameter(0);
   Reference catch_block = cast<Context>(context).parameter(1);
 
-    try {
-      cast<meat::Context>(try_block).messenger(context);
-      execute(try_block);
-    } catch (std::exception &err) {
-      cast<Context>(catch_block).messenger(context);
-      execute(catch_block);
+    Context &ctx = cast<Context>(context);
+    switch (ctx.step()) {
+    case 0:
+      return ctx.invoke(try_block, true);
+    case 1:
+      if (ctx.caught() != null) return ctx.invoke(catch_block);
+      break;
+    default:
       cast<BlockContext>(try_block).reset();
     }
 
@@ -896,14 +892,17 @@ static Reference Exception_cm_try_catch_do_(Reference context) {
   Reference _error = cast<Context>(context).parameter(1);
   Reference catch_block = cast<Context>(context).parameter(2);
 
-    try {
-      cast<Context>(try_block).messenger(context);
-      execute(try_block);
-    } catch (Exception &err) {
-      Reference excp = new meat::Exception(err);
-      cast<BlockParameter>(_error).set_parameter(excp);
-      cast<Context>(catch_block).messenger(context);
-      execute(catch_block);
+    Context &ctx = cast<Context>(context);
+    switch (ctx.step()) {
+    case 0:
+      return ctx.invoke(try_block, true);
+    case 1:
+      if (ctx.caught() != null) {
+        cast<BlockParameter>(_error).set_parameter(ctx.caught());
+        return ctx.invoke(catch_block);
+      }
+      break;
+    default:
       cast<BlockContext>(try_block).reset();
     }
 
@@ -911,27 +910,27 @@ static Reference Exception_cm_try_catch_do_(Reference context) {
   }
 
 static meat::vtable_entry_t ExceptionCMethods[] = {
-  {0x00000782, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x000007a0, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x00019850, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x003675df, 0x4fc26166, VTM_NATIVE  , 1, {(meat::method_ptr_t)Exception_cm_try_}},
-  {0x00368f3a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x068b6f7b, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x0693a6e6, 0x4fc26166, VTM_NATIVE  , 0, {(meat::method_ptr_t)Exception_cm_throw}},
-  {0x20be875b, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x24ab71da, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x351bfdf2, 0x4fc26166, VTM_NATIVE  , 1, {(meat::method_ptr_t)Exception_cm_throwFor_}},
-  {0x39a68c12, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x39a6a1d2, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x4be13615, 0x4fc26166, VTM_NATIVE  , 1, {(meat::method_ptr_t)Exception_cm_throw_}},
-  {0x4e48308e, 0x4fc26166, VTM_NATIVE  , 3, {(meat::method_ptr_t)Exception_cm_try_catch_do_}},
-  {0x54aa30e6, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x6b2d9a7a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x6db68ab6, 0x4fc26166, VTM_NATIVE  , 2, {(meat::method_ptr_t)Exception_cm_throw_for_}},
-  {0x7a8e569a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x7b840562, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x7bebbd56, 0x4fc26166, VTM_NATIVE  , 2, {(meat::method_ptr_t)Exception_cm_try_catch_}},
-  {0x7d180801, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}}
+  {0x00000782, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x000007a0, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x00019850, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x003675df, 0x4fc26166, VTM_NATIVE  , 1, {(meat::method_ptr_t)Exception_cm_try_}, 0},
+  {0x00368f3a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x068b6f7b, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x0693a6e6, 0x4fc26166, VTM_NATIVE  , 0, {(meat::method_ptr_t)Exception_cm_throw}, 0},
+  {0x20be875b, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x24ab71da, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x351bfdf2, 0x4fc26166, VTM_NATIVE  , 1, {(meat::method_ptr_t)Exception_cm_throwFor_}, 0},
+  {0x39a68c12, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x39a6a1d2, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x4be13615, 0x4fc26166, VTM_NATIVE  , 1, {(meat::method_ptr_t)Exception_cm_throw_}, 0},
+  {0x4e48308e, 0x4fc26166, VTM_NATIVE  , 3, {(meat::method_ptr_t)Exception_cm_try_catch_do_}, 0},
+  {0x54aa30e6, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x6b2d9a7a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x6db68ab6, 0x4fc26166, VTM_NATIVE  , 2, {(meat::method_ptr_t)Exception_cm_throw_for_}, 0},
+  {0x7a8e569a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x7b840562, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x7bebbd56, 0x4fc26166, VTM_NATIVE  , 2, {(meat::method_ptr_t)Exception_cm_try_catch_}, 0},
+  {0x7d180801, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0}
 };
 
 static std::uint8_t ExceptionBytecode[] = {
@@ -951,49 +950,49 @@ static std::uint8_t ExceptionBytecode[] = {
 #define _returnContext (klass->property(2))
 
 static meat::vtable_entry_t Exception2Methods[] = {
-  {0x00000782, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x000007a0, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x00019850, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x00368f3a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x00379f78, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x20be875b, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x24ab71da, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x331152ee, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x34003578, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x38b735d9, 0x2889cb9f, VTM_BYTECODE, 5, {(meat::method_ptr_t)0}},
-  {0x38eb0035, 0x2889cb9f, VTM_BYTECODE, 5, {(meat::method_ptr_t)12}},
-  {0x39a68c12, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x39a6a1d2, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x48dbf560, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x6b2d9a7a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x7a8e569a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x7b840562, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x7d180801, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}}
+  {0x00000782, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x000007a0, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x00019850, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x00368f3a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x00379f78, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x20be875b, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x24ab71da, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x331152ee, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x34003578, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x38b735d9, 0x2889cb9f, VTM_BYTECODE, 5, {(meat::method_ptr_t)0}, 0},
+  {0x38eb0035, 0x2889cb9f, VTM_BYTECODE, 5, {(meat::method_ptr_t)12}, 0},
+  {0x39a68c12, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x39a6a1d2, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x48dbf560, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x6b2d9a7a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x7a8e569a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x7b840562, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x7d180801, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0}
 };
 
 #undef _message
 #undef _context
 
 static meat::vtable_entry_t Exception2CMethods[] = {
-  {0x00000782, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x000007a0, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x00019850, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x003675df, 0x2889cb9f, VTM_BYTECODE, 9, {(meat::method_ptr_t)224}},
-  {0x00368f3a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x068b6f7b, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x20be875b, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x24ab71da, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x39a68c12, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x39a6a1d2, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x4be13615, 0x2889cb9f, VTM_BYTECODE, 8, {(meat::method_ptr_t)24}},
-  {0x4e48308e, 0x2889cb9f, VTM_BYTECODE, 11, {(meat::method_ptr_t)294}},
-  {0x54aa30e6, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x6b2d9a7a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x6db68ab6, 0x2889cb9f, VTM_BYTECODE, 9, {(meat::method_ptr_t)128}},
-  {0x7a8e569a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x7b840562, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x7bebbd56, 0x2889cb9f, VTM_BYTECODE, 10, {(meat::method_ptr_t)259}},
-  {0x7d180801, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}}
+  {0x00000782, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x000007a0, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x00019850, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x003675df, 0x2889cb9f, VTM_BYTECODE, 9, {(meat::method_ptr_t)224}, 0},
+  {0x00368f3a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x068b6f7b, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x20be875b, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x24ab71da, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x39a68c12, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x39a6a1d2, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x4be13615, 0x2889cb9f, VTM_BYTECODE, 8, {(meat::method_ptr_t)24}, 0},
+  {0x4e48308e, 0x2889cb9f, VTM_BYTECODE, 11, {(meat::method_ptr_t)294}, 0},
+  {0x54aa30e6, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x6b2d9a7a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x6db68ab6, 0x2889cb9f, VTM_BYTECODE, 9, {(meat::method_ptr_t)128}, 0},
+  {0x7a8e569a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x7b840562, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x7bebbd56, 0x2889cb9f, VTM_BYTECODE, 10, {(meat::method_ptr_t)259}, 0},
+  {0x7d180801, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0}
 };
 
 #undef _exceptionBlock
@@ -1051,11 +1050,11 @@ static Reference Boolean_om_isFalse_(Reference context) {
   Reference klass = cast<Context>(context).klass();
   Reference block = cast<Context>(context).parameter(0);
 
-    if (self == falseObject) {
-      cast<BlockContext>(block).messenger(context);
-      execute(block);
+    Context &ctx = cast<Context>(context);
+    if (ctx.step() == 0) {
+      if (self == falseObject) return ctx.invoke(block);
+    } else
       cast<BlockContext>(block).reset();
-    }
     return null;
   }
 
@@ -1066,15 +1065,10 @@ static Reference Boolean_om_isFalse_else_(Reference context) {
   Reference falseBlock = cast<Context>(context).parameter(0);
   Reference elseBlock = cast<Context>(context).parameter(1);
 
-    if (self == falseObject) {
-      cast<BlockContext>(falseBlock).messenger(context);
-      execute(falseBlock);
-      cast<BlockContext>(falseBlock).reset();
-    } else {
-      cast<BlockContext>(elseBlock).messenger(context);
-      execute(elseBlock);
-      cast<BlockContext>(elseBlock).reset();
-    }
+    Reference block = (self == falseObject ? falseBlock : elseBlock);
+    Context &ctx = cast<Context>(context);
+    if (ctx.step() == 0) return ctx.invoke(block);
+    cast<BlockContext>(block).reset();
     return null;
   }
 
@@ -1084,10 +1078,8 @@ static Reference Boolean_om_isTrue_(Reference context) {
   Reference klass = cast<Context>(context).klass();
   Reference block = cast<Context>(context).parameter(0);
 
-    if (self == trueObject) {
-      cast<BlockContext>(block).messenger(context);
-      execute(block);
-    }
+    Context &ctx = cast<Context>(context);
+    if (ctx.step() == 0 and self == trueObject) return ctx.invoke(block);
     return null;
   }
 
@@ -1098,13 +1090,9 @@ static Reference Boolean_om_isTrue_else_(Reference context) {
   Reference trueBlock = cast<Context>(context).parameter(0);
   Reference elseBlock = cast<Context>(context).parameter(1);
 
-    if (self == trueObject) {
-      cast<BlockContext>(trueBlock).messenger(context);
-      execute(trueBlock);
-    } else {
-      cast<BlockContext>(elseBlock).messenger(context);
-      execute(elseBlock);
-    }
+    Context &ctx = cast<Context>(context);
+    if (ctx.step() == 0)
+      return ctx.invoke(self == trueObject ? trueBlock : elseBlock);
     return null;
   }
 
@@ -1127,50 +1115,50 @@ static Reference Boolean_om_xor_(Reference context) {
   }
 
 static meat::vtable_entry_t BooleanMethods[] = {
-  {0x00000782, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x000007a0, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x00019850, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x0001aad3, 0x67140424, VTM_BYTECODE, 8, {(meat::method_ptr_t)65}},
-  {0x0001aeb7, 0x67140424, VTM_NATIVE  , 1, {(meat::method_ptr_t)Boolean_om_or_}},
-  {0x002dc143, 0x67140424, VTM_NATIVE  , 1, {(meat::method_ptr_t)Boolean_om_and_}},
-  {0x00368f3a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x00379f78, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x00383b3f, 0x67140424, VTM_NATIVE  , 1, {(meat::method_ptr_t)Boolean_om_xor_}},
-  {0x20be875b, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x24ab71da, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x2c025c80, 0x67140424, VTM_BYTECODE, 8, {(meat::method_ptr_t)0}},
-  {0x331152ee, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x34003578, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x39a68c12, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x39a6a1d2, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x47607971, 0x67140424, VTM_NATIVE  , 2, {(meat::method_ptr_t)Boolean_om_isTrue_else_}},
-  {0x48dbf560, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x57c628fe, 0x67140424, VTM_NATIVE  , 2, {(meat::method_ptr_t)Boolean_om_isFalse_else_}},
-  {0x5bc502b2, 0x67140424, VTM_NATIVE  , 1, {(meat::method_ptr_t)Boolean_om_isFalse_}},
-  {0x6b2d9a7a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x7a8e569a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x7b80e98e, 0x67140424, VTM_NATIVE  , 1, {(meat::method_ptr_t)Boolean_om_isTrue_}},
-  {0x7b840562, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x7d180801, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}}
+  {0x00000782, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x000007a0, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x00019850, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x0001aad3, 0x67140424, VTM_BYTECODE, 8, {(meat::method_ptr_t)65}, 0},
+  {0x0001aeb7, 0x67140424, VTM_NATIVE  , 1, {(meat::method_ptr_t)Boolean_om_or_}, 0},
+  {0x002dc143, 0x67140424, VTM_NATIVE  , 1, {(meat::method_ptr_t)Boolean_om_and_}, 0},
+  {0x00368f3a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x00379f78, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x00383b3f, 0x67140424, VTM_NATIVE  , 1, {(meat::method_ptr_t)Boolean_om_xor_}, 0},
+  {0x20be875b, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x24ab71da, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x2c025c80, 0x67140424, VTM_BYTECODE, 8, {(meat::method_ptr_t)0}, 0},
+  {0x331152ee, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x34003578, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x39a68c12, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x39a6a1d2, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x47607971, 0x67140424, VTM_NATIVE  , 2, {(meat::method_ptr_t)Boolean_om_isTrue_else_}, 0},
+  {0x48dbf560, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x57c628fe, 0x67140424, VTM_NATIVE  , 2, {(meat::method_ptr_t)Boolean_om_isFalse_else_}, 0},
+  {0x5bc502b2, 0x67140424, VTM_NATIVE  , 1, {(meat::method_ptr_t)Boolean_om_isFalse_}, 0},
+  {0x6b2d9a7a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x7a8e569a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x7b80e98e, 0x67140424, VTM_NATIVE  , 1, {(meat::method_ptr_t)Boolean_om_isTrue_}, 0},
+  {0x7b840562, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x7d180801, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0}
 };
 
 static meat::vtable_entry_t BooleanCMethods[] = {
-  {0x00000782, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x000007a0, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x00019850, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x0036758e, 0x67140424, VTM_BYTECODE, 5, {(meat::method_ptr_t)133}},
-  {0x00368f3a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x05cb1923, 0x67140424, VTM_BYTECODE, 5, {(meat::method_ptr_t)121}},
-  {0x068b6f7b, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x20be875b, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x24ab71da, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x39a68c12, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x39a6a1d2, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x54aa30e6, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x6b2d9a7a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x7a8e569a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x7b840562, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x7d180801, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}}
+  {0x00000782, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x000007a0, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x00019850, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x0036758e, 0x67140424, VTM_BYTECODE, 5, {(meat::method_ptr_t)133}, 0},
+  {0x00368f3a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x05cb1923, 0x67140424, VTM_BYTECODE, 5, {(meat::method_ptr_t)121}, 0},
+  {0x068b6f7b, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x20be875b, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x24ab71da, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x39a68c12, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x39a6a1d2, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x54aa30e6, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x6b2d9a7a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x7a8e569a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x7b840562, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x7d180801, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0}
 };
 
 #undef trueObject
@@ -1199,7 +1187,7 @@ static Reference BlockParameter_constructor(
   Reference &klass,
   std::uint8_t properties) {
 
-    return new BlockParameter(klass, properties);
+    return new (properties) BlockParameter(klass, properties);
   
 }
 
@@ -1207,44 +1195,44 @@ static Reference BlockParameter_constructor(
 #define localIndex (self->property(1))
 
 static meat::vtable_entry_t BlockParameterMethods[] = {
-  {0x00000782, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x000007a0, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x00019850, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x00368f3a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x00379f78, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x20be875b, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x24ab71da, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x2536833e, 0x0efec3f6, VTM_BYTECODE, 7, {(meat::method_ptr_t)24}},
-  {0x331152ee, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x34003578, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x39a68c12, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x39a6a1d2, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x48dbf560, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x6b2d9a7a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x754a3d0d, 0x0efec3f6, VTM_BYTECODE, 7, {(meat::method_ptr_t)0}},
-  {0x7a8e569a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x7b840562, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x7d180801, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}}
+  {0x00000782, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x000007a0, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x00019850, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x00368f3a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x00379f78, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x20be875b, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x24ab71da, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x2536833e, 0x0efec3f6, VTM_BYTECODE, 7, {(meat::method_ptr_t)24}, 0},
+  {0x331152ee, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x34003578, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x39a68c12, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x39a6a1d2, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x48dbf560, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x6b2d9a7a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x754a3d0d, 0x0efec3f6, VTM_BYTECODE, 7, {(meat::method_ptr_t)0}, 0},
+  {0x7a8e569a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x7b840562, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x7d180801, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0}
 };
 
 #undef blockContext
 #undef localIndex
 
 static meat::vtable_entry_t BlockParameterCMethods[] = {
-  {0x00000782, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x000007a0, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x00019850, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x00368f3a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x068b6f7b, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x20be875b, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x24ab71da, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x39a68c12, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x39a6a1d2, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x54aa30e6, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x6b2d9a7a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x7a8e569a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x7b840562, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x7d180801, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}}
+  {0x00000782, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x000007a0, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x00019850, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x00368f3a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x068b6f7b, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x20be875b, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x24ab71da, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x39a68c12, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x39a6a1d2, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x54aa30e6, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x6b2d9a7a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x7a8e569a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x7b840562, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x7d180801, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0}
 };
 
 static std::uint8_t BlockParameterBytecode[] = {
@@ -1259,54 +1247,54 @@ static std::uint8_t BlockParameterBytecode[] = {
  */
 
 static meat::vtable_entry_t NumericMethods[] = {
-  {0x00000025, 0x6bfcb30e, VTM_BYTECODE, 7, {(meat::method_ptr_t)0}},
-  {0x0000002a, 0x6bfcb30e, VTM_BYTECODE, 7, {(meat::method_ptr_t)36}},
-  {0x0000002b, 0x6bfcb30e, VTM_BYTECODE, 7, {(meat::method_ptr_t)72}},
-  {0x0000002d, 0x6bfcb30e, VTM_BYTECODE, 7, {(meat::method_ptr_t)108}},
-  {0x0000002f, 0x6bfcb30e, VTM_BYTECODE, 7, {(meat::method_ptr_t)144}},
-  {0x0000003c, 0x6bfcb30e, VTM_BYTECODE, 7, {(meat::method_ptr_t)180}},
-  {0x0000003e, 0x6bfcb30e, VTM_BYTECODE, 7, {(meat::method_ptr_t)327}},
-  {0x0000005e, 0x6bfcb30e, VTM_BYTECODE, 7, {(meat::method_ptr_t)400}},
-  {0x00000781, 0x6bfcb30e, VTM_BYTECODE, 7, {(meat::method_ptr_t)216}},
-  {0x00000782, 0x6bfcb30e, VTM_BYTECODE, 7, {(meat::method_ptr_t)253}},
-  {0x000007a0, 0x6bfcb30e, VTM_BYTECODE, 7, {(meat::method_ptr_t)290}},
-  {0x000007bf, 0x6bfcb30e, VTM_BYTECODE, 7, {(meat::method_ptr_t)363}},
-  {0x00019850, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x00368f3a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x00379f78, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x20be875b, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x24ab71da, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x2c025c80, 0x6bfcb30e, VTM_BYTECODE, 6, {(meat::method_ptr_t)479}},
-  {0x331152ee, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x34003578, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x36e711e1, 0x6bfcb30e, VTM_BYTECODE, 6, {(meat::method_ptr_t)536}},
-  {0x39a68c12, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x39a6a1d2, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x48dbf560, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x6701127b, 0x6bfcb30e, VTM_BYTECODE, 6, {(meat::method_ptr_t)436}},
-  {0x6b2d9a7a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x7a8e569a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x7b840562, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x7d180801, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}}
+  {0x00000025, 0x6bfcb30e, VTM_BYTECODE, 7, {(meat::method_ptr_t)0}, 0},
+  {0x0000002a, 0x6bfcb30e, VTM_BYTECODE, 7, {(meat::method_ptr_t)36}, 0},
+  {0x0000002b, 0x6bfcb30e, VTM_BYTECODE, 7, {(meat::method_ptr_t)72}, 0},
+  {0x0000002d, 0x6bfcb30e, VTM_BYTECODE, 7, {(meat::method_ptr_t)108}, 0},
+  {0x0000002f, 0x6bfcb30e, VTM_BYTECODE, 7, {(meat::method_ptr_t)144}, 0},
+  {0x0000003c, 0x6bfcb30e, VTM_BYTECODE, 7, {(meat::method_ptr_t)180}, 0},
+  {0x0000003e, 0x6bfcb30e, VTM_BYTECODE, 7, {(meat::method_ptr_t)327}, 0},
+  {0x0000005e, 0x6bfcb30e, VTM_BYTECODE, 7, {(meat::method_ptr_t)400}, 0},
+  {0x00000781, 0x6bfcb30e, VTM_BYTECODE, 7, {(meat::method_ptr_t)216}, 0},
+  {0x00000782, 0x6bfcb30e, VTM_BYTECODE, 7, {(meat::method_ptr_t)253}, 0},
+  {0x000007a0, 0x6bfcb30e, VTM_BYTECODE, 7, {(meat::method_ptr_t)290}, 0},
+  {0x000007bf, 0x6bfcb30e, VTM_BYTECODE, 7, {(meat::method_ptr_t)363}, 0},
+  {0x00019850, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x00368f3a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x00379f78, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x20be875b, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x24ab71da, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x2c025c80, 0x6bfcb30e, VTM_BYTECODE, 6, {(meat::method_ptr_t)479}, 0},
+  {0x331152ee, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x34003578, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x36e711e1, 0x6bfcb30e, VTM_BYTECODE, 6, {(meat::method_ptr_t)536}, 0},
+  {0x39a68c12, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x39a6a1d2, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x48dbf560, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x6701127b, 0x6bfcb30e, VTM_BYTECODE, 6, {(meat::method_ptr_t)436}, 0},
+  {0x6b2d9a7a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x7a8e569a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x7b840562, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x7d180801, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0}
 };
 
 static meat::vtable_entry_t NumericCMethods[] = {
-  {0x00000782, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x000007a0, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x00019850, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x00368f3a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x068b6f7b, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x17cbc00b, 0x6bfcb30e, VTM_BYTECODE, 6, {(meat::method_ptr_t)579}},
-  {0x20be875b, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x24ab71da, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x2ded23e0, 0x6bfcb30e, VTM_BYTECODE, 6, {(meat::method_ptr_t)631}},
-  {0x39a68c12, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x39a6a1d2, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x54aa30e6, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x6b2d9a7a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x7a8e569a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x7b840562, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x7d180801, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}}
+  {0x00000782, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x000007a0, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x00019850, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x00368f3a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x068b6f7b, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x17cbc00b, 0x6bfcb30e, VTM_BYTECODE, 6, {(meat::method_ptr_t)579}, 0},
+  {0x20be875b, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x24ab71da, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x2ded23e0, 0x6bfcb30e, VTM_BYTECODE, 6, {(meat::method_ptr_t)631}, 0},
+  {0x39a68c12, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x39a6a1d2, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x54aa30e6, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x6b2d9a7a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x7a8e569a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x7b840562, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x7d180801, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0}
 };
 
 static std::uint8_t NumericBytecode[] = {
@@ -1373,7 +1361,7 @@ static Reference Integer_constructor(
   Reference &klass,
   std::uint8_t properties) {
 
-    return new Value(klass, properties);
+    return new (properties) Value(klass, properties);
   
 }
 
@@ -1383,7 +1371,7 @@ static Reference Integer_om_mod(Reference context) {
   Reference klass = cast<Context>(context).klass();
   Reference other = cast<Context>(context).parameter(0);
 
-    return new Value(INTEGER(self) % INTEGER(other));
+    return Integer(INTEGER(self) % INTEGER(other));
   }
 
 // method *
@@ -1392,7 +1380,7 @@ static Reference Integer_om_mult(Reference context) {
   Reference klass = cast<Context>(context).klass();
   Reference other = cast<Context>(context).parameter(0);
 
-    return new Value(INTEGER(self) * INTEGER(other));
+    return Integer(INTEGER(self) * INTEGER(other));
   }
 
 // method +
@@ -1401,7 +1389,7 @@ static Reference Integer_om_add(Reference context) {
   Reference klass = cast<Context>(context).klass();
   Reference other = cast<Context>(context).parameter(0);
 
-    return new Value(INTEGER(self) + INTEGER(other));
+    return Integer(INTEGER(self) + INTEGER(other));
   }
 
 // method -
@@ -1410,7 +1398,7 @@ static Reference Integer_om_sub(Reference context) {
   Reference klass = cast<Context>(context).klass();
   Reference other = cast<Context>(context).parameter(0);
 
-    return new Value(INTEGER(self) - INTEGER(other));
+    return Integer(INTEGER(self) - INTEGER(other));
   }
 
 // method /
@@ -1419,7 +1407,7 @@ static Reference Integer_om_div(Reference context) {
   Reference klass = cast<Context>(context).klass();
   Reference other = cast<Context>(context).parameter(0);
 
-    return new Value(INTEGER(self) / INTEGER(other));
+    return Integer(INTEGER(self) / INTEGER(other));
   }
 
 // method <
@@ -1509,7 +1497,7 @@ static Reference Integer_om_absolute(Reference context) {
   Reference self = cast<Context>(context).self();
   Reference klass = cast<Context>(context).klass();
 
-    return new Value(std::abs(INTEGER(self)));
+    return Integer(std::abs(INTEGER(self)));
   }
 
 // method and:
@@ -1518,7 +1506,7 @@ static Reference Integer_om_and_(Reference context) {
   Reference klass = cast<Context>(context).klass();
   Reference other = cast<Context>(context).parameter(0);
 
-    return new Value(INTEGER(self) & INTEGER(other));
+    return Integer(INTEGER(self) & INTEGER(other));
   }
 
 // method asText
@@ -1536,7 +1524,7 @@ static Reference Integer_om_lshift(Reference context) {
   Reference self = cast<Context>(context).self();
   Reference klass = cast<Context>(context).klass();
 
-    return new Value(INTEGER(self) << 1);
+    return Integer(INTEGER(self) << 1);
   }
 
 // method lshift:
@@ -1545,7 +1533,7 @@ static Reference Integer_om_lshift_(Reference context) {
   Reference klass = cast<Context>(context).klass();
   Reference amount = cast<Context>(context).parameter(0);
 
-    return new Value(INTEGER(self) << INTEGER(amount));
+    return Integer(INTEGER(self) << INTEGER(amount));
   }
 
 // method negative
@@ -1553,7 +1541,7 @@ static Reference Integer_om_negative(Reference context) {
   Reference self = cast<Context>(context).self();
   Reference klass = cast<Context>(context).klass();
 
-    return new meat::Value(-INTEGER(self));
+    return Integer(-INTEGER(self));
   }
 
 // method or:
@@ -1562,7 +1550,7 @@ static Reference Integer_om_or_(Reference context) {
   Reference klass = cast<Context>(context).klass();
   Reference other = cast<Context>(context).parameter(0);
 
-    return new Value(INTEGER(self) | INTEGER(other));
+    return Integer(INTEGER(self) | INTEGER(other));
   }
 
 // method rshift
@@ -1570,7 +1558,7 @@ static Reference Integer_om_rshift(Reference context) {
   Reference self = cast<Context>(context).self();
   Reference klass = cast<Context>(context).klass();
 
-    return new Value(INTEGER(self) >> 1);
+    return Integer(INTEGER(self) >> 1);
   }
 
 // method rshift:
@@ -1579,7 +1567,7 @@ static Reference Integer_om_rshift_(Reference context) {
   Reference klass = cast<Context>(context).klass();
   Reference amount = cast<Context>(context).parameter(0);
 
-    return new Value(INTEGER(self) >> INTEGER(amount));
+    return Integer(INTEGER(self) >> INTEGER(amount));
   }
 
 // method timesDo:
@@ -1588,10 +1576,9 @@ static Reference Integer_om_timesDo_(Reference context) {
   Reference klass = cast<Context>(context).klass();
   Reference block = cast<Context>(context).parameter(0);
 
-    std::int32_t limit = INTEGER(self);
-    for (std::int_fast32_t c = 0; c < limit; c++) {
-      execute(block);
-    }
+    Context &ctx = cast<Context>(context);
+    if (ctx.step() > 0) cast<BlockContext>(block).reset();
+    if ((std::int64_t)ctx.step() < INTEGER(self)) return ctx.invoke(block);
     return null;
   }
 
@@ -1601,47 +1588,47 @@ static Reference Integer_om_xor_(Reference context) {
   Reference klass = cast<Context>(context).klass();
   Reference other = cast<Context>(context).parameter(0);
 
-    return new Value(INTEGER(self) ^ INTEGER(other));
+    return Integer(INTEGER(self) ^ INTEGER(other));
   }
 
 static meat::vtable_entry_t IntegerMethods[] = {
-  {0x00000025, 0x57ee193d, VTM_NATIVE  , 1, {(meat::method_ptr_t)Integer_om_mod}},
-  {0x0000002a, 0x57ee193d, VTM_NATIVE  , 1, {(meat::method_ptr_t)Integer_om_mult}},
-  {0x0000002b, 0x57ee193d, VTM_NATIVE  , 1, {(meat::method_ptr_t)Integer_om_add}},
-  {0x0000002d, 0x57ee193d, VTM_NATIVE  , 1, {(meat::method_ptr_t)Integer_om_sub}},
-  {0x0000002f, 0x57ee193d, VTM_NATIVE  , 1, {(meat::method_ptr_t)Integer_om_div}},
-  {0x0000003c, 0x57ee193d, VTM_NATIVE  , 1, {(meat::method_ptr_t)Integer_om_less}},
-  {0x0000003e, 0x57ee193d, VTM_NATIVE  , 1, {(meat::method_ptr_t)Integer_om_greater}},
-  {0x0000005e, 0x57ee193d, VTM_NATIVE  , 1, {(meat::method_ptr_t)Integer_om_pow}},
-  {0x00000781, 0x57ee193d, VTM_NATIVE  , 1, {(meat::method_ptr_t)Integer_om_less_equal}},
-  {0x00000782, 0x57ee193d, VTM_NATIVE  , 1, {(meat::method_ptr_t)Integer_om_nequals}},
-  {0x000007a0, 0x57ee193d, VTM_NATIVE  , 1, {(meat::method_ptr_t)Integer_om_equals}},
-  {0x000007bf, 0x57ee193d, VTM_NATIVE  , 1, {(meat::method_ptr_t)Integer_om_greater_equal}},
-  {0x00019850, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x0001aeb7, 0x57ee193d, VTM_NATIVE  , 1, {(meat::method_ptr_t)Integer_om_or_}},
-  {0x002dc143, 0x57ee193d, VTM_NATIVE  , 1, {(meat::method_ptr_t)Integer_om_and_}},
-  {0x00368f3a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x00379f78, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x00383b3f, 0x57ee193d, VTM_NATIVE  , 1, {(meat::method_ptr_t)Integer_om_xor_}},
-  {0x043b7de4, 0x57ee193d, VTM_NATIVE  , 1, {(meat::method_ptr_t)Integer_om_timesDo_}},
-  {0x1b492392, 0x57ee193d, VTM_NATIVE  , 1, {(meat::method_ptr_t)Integer_om_lshift_}},
-  {0x20be875b, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x24ab71da, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x2c025c80, 0x57ee193d, VTM_NATIVE  , 0, {(meat::method_ptr_t)Integer_om_asText}},
-  {0x331152ee, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x34003578, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x36e711e1, 0x57ee193d, VTM_NATIVE  , 0, {(meat::method_ptr_t)Integer_om_negative}},
-  {0x39a68c12, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x39a6a1d2, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x3ed0cf97, 0x57ee193d, VTM_NATIVE  , 0, {(meat::method_ptr_t)Integer_om_lshift}},
-  {0x48dbf560, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x490de351, 0x57ee193d, VTM_NATIVE  , 0, {(meat::method_ptr_t)Integer_om_rshift}},
-  {0x58ae871a, 0x57ee193d, VTM_NATIVE  , 1, {(meat::method_ptr_t)Integer_om_rshift_}},
-  {0x6701127b, 0x57ee193d, VTM_NATIVE  , 0, {(meat::method_ptr_t)Integer_om_absolute}},
-  {0x6b2d9a7a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x7a8e569a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x7b840562, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x7d180801, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}}
+  {0x00000025, 0x57ee193d, VTM_NATIVE  , 1, {(meat::method_ptr_t)Integer_om_mod}, 0},
+  {0x0000002a, 0x57ee193d, VTM_NATIVE  , 1, {(meat::method_ptr_t)Integer_om_mult}, 0},
+  {0x0000002b, 0x57ee193d, VTM_NATIVE  , 1, {(meat::method_ptr_t)Integer_om_add}, 0},
+  {0x0000002d, 0x57ee193d, VTM_NATIVE  , 1, {(meat::method_ptr_t)Integer_om_sub}, 0},
+  {0x0000002f, 0x57ee193d, VTM_NATIVE  , 1, {(meat::method_ptr_t)Integer_om_div}, 0},
+  {0x0000003c, 0x57ee193d, VTM_NATIVE  , 1, {(meat::method_ptr_t)Integer_om_less}, 0},
+  {0x0000003e, 0x57ee193d, VTM_NATIVE  , 1, {(meat::method_ptr_t)Integer_om_greater}, 0},
+  {0x0000005e, 0x57ee193d, VTM_NATIVE  , 1, {(meat::method_ptr_t)Integer_om_pow}, 0},
+  {0x00000781, 0x57ee193d, VTM_NATIVE  , 1, {(meat::method_ptr_t)Integer_om_less_equal}, 0},
+  {0x00000782, 0x57ee193d, VTM_NATIVE  , 1, {(meat::method_ptr_t)Integer_om_nequals}, 0},
+  {0x000007a0, 0x57ee193d, VTM_NATIVE  , 1, {(meat::method_ptr_t)Integer_om_equals}, 0},
+  {0x000007bf, 0x57ee193d, VTM_NATIVE  , 1, {(meat::method_ptr_t)Integer_om_greater_equal}, 0},
+  {0x00019850, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x0001aeb7, 0x57ee193d, VTM_NATIVE  , 1, {(meat::method_ptr_t)Integer_om_or_}, 0},
+  {0x002dc143, 0x57ee193d, VTM_NATIVE  , 1, {(meat::method_ptr_t)Integer_om_and_}, 0},
+  {0x00368f3a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x00379f78, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x00383b3f, 0x57ee193d, VTM_NATIVE  , 1, {(meat::method_ptr_t)Integer_om_xor_}, 0},
+  {0x043b7de4, 0x57ee193d, VTM_NATIVE  , 1, {(meat::method_ptr_t)Integer_om_timesDo_}, 0},
+  {0x1b492392, 0x57ee193d, VTM_NATIVE  , 1, {(meat::method_ptr_t)Integer_om_lshift_}, 0},
+  {0x20be875b, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x24ab71da, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x2c025c80, 0x57ee193d, VTM_NATIVE  , 0, {(meat::method_ptr_t)Integer_om_asText}, 0},
+  {0x331152ee, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x34003578, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x36e711e1, 0x57ee193d, VTM_NATIVE  , 0, {(meat::method_ptr_t)Integer_om_negative}, 0},
+  {0x39a68c12, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x39a6a1d2, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x3ed0cf97, 0x57ee193d, VTM_NATIVE  , 0, {(meat::method_ptr_t)Integer_om_lshift}, 0},
+  {0x48dbf560, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x490de351, 0x57ee193d, VTM_NATIVE  , 0, {(meat::method_ptr_t)Integer_om_rshift}, 0},
+  {0x58ae871a, 0x57ee193d, VTM_NATIVE  , 1, {(meat::method_ptr_t)Integer_om_rshift_}, 0},
+  {0x6701127b, 0x57ee193d, VTM_NATIVE  , 0, {(meat::method_ptr_t)Integer_om_absolute}, 0},
+  {0x6b2d9a7a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x7a8e569a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x7b840562, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x7d180801, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0}
 };
 
 // class method maxValue
@@ -1649,7 +1636,7 @@ static Reference Integer_cm_maxValue(Reference context) {
   Reference self = cast<Context>(context).self();
   Reference klass = cast<Context>(context).klass();
 
-    return new Value(2147483647);
+    return Integer(2147483647);
   }
 
 // class method minValue
@@ -1657,26 +1644,26 @@ static Reference Integer_cm_minValue(Reference context) {
   Reference self = cast<Context>(context).self();
   Reference klass = cast<Context>(context).klass();
 
-    return new Value(-2147483647-1);
+    return Integer(-2147483647-1);
   }
 
 static meat::vtable_entry_t IntegerCMethods[] = {
-  {0x00000782, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x000007a0, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x00019850, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x00368f3a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x068b6f7b, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x17cbc00b, 0x57ee193d, VTM_NATIVE  , 0, {(meat::method_ptr_t)Integer_cm_maxValue}},
-  {0x20be875b, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x24ab71da, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x2ded23e0, 0x57ee193d, VTM_NATIVE  , 0, {(meat::method_ptr_t)Integer_cm_minValue}},
-  {0x39a68c12, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x39a6a1d2, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x54aa30e6, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x6b2d9a7a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x7a8e569a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x7b840562, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x7d180801, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}}
+  {0x00000782, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x000007a0, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x00019850, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x00368f3a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x068b6f7b, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x17cbc00b, 0x57ee193d, VTM_NATIVE  , 0, {(meat::method_ptr_t)Integer_cm_maxValue}, 0},
+  {0x20be875b, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x24ab71da, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x2ded23e0, 0x57ee193d, VTM_NATIVE  , 0, {(meat::method_ptr_t)Integer_cm_minValue}, 0},
+  {0x39a68c12, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x39a6a1d2, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x54aa30e6, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x6b2d9a7a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x7a8e569a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x7b840562, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x7d180801, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0}
 };
 
 /******************************************************************************
@@ -1687,7 +1674,7 @@ static Reference Number_constructor(
   Reference &klass,
   std::uint8_t properties) {
 
-    return new Value(klass, properties);
+    return new (properties) Value(klass, properties);
   
 }
 
@@ -1848,54 +1835,54 @@ static Reference Number_om_negative(Reference context) {
   }
 
 static meat::vtable_entry_t NumberMethods[] = {
-  {0x00000025, 0x0bbdc76a, VTM_NATIVE  , 1, {(meat::method_ptr_t)Number_om_mod}},
-  {0x0000002a, 0x0bbdc76a, VTM_NATIVE  , 1, {(meat::method_ptr_t)Number_om_mult}},
-  {0x0000002b, 0x0bbdc76a, VTM_NATIVE  , 1, {(meat::method_ptr_t)Number_om_add}},
-  {0x0000002d, 0x0bbdc76a, VTM_NATIVE  , 1, {(meat::method_ptr_t)Number_om_sub}},
-  {0x0000002f, 0x0bbdc76a, VTM_NATIVE  , 1, {(meat::method_ptr_t)Number_om_div}},
-  {0x0000003c, 0x0bbdc76a, VTM_NATIVE  , 1, {(meat::method_ptr_t)Number_om_less}},
-  {0x0000003e, 0x0bbdc76a, VTM_NATIVE  , 1, {(meat::method_ptr_t)Number_om_greater}},
-  {0x0000005e, 0x0bbdc76a, VTM_NATIVE  , 1, {(meat::method_ptr_t)Number_om_pow}},
-  {0x00000781, 0x0bbdc76a, VTM_NATIVE  , 1, {(meat::method_ptr_t)Number_om_less_equal}},
-  {0x00000782, 0x0bbdc76a, VTM_NATIVE  , 1, {(meat::method_ptr_t)Number_om_nequals}},
-  {0x000007a0, 0x0bbdc76a, VTM_NATIVE  , 1, {(meat::method_ptr_t)Number_om_equals}},
-  {0x000007bf, 0x0bbdc76a, VTM_NATIVE  , 1, {(meat::method_ptr_t)Number_om_greater_equal}},
-  {0x00019850, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x00368f3a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x00379f78, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x20be875b, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x24ab71da, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x2c025c80, 0x0bbdc76a, VTM_NATIVE  , 0, {(meat::method_ptr_t)Number_om_asText}},
-  {0x331152ee, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x34003578, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x36e711e1, 0x0bbdc76a, VTM_NATIVE  , 0, {(meat::method_ptr_t)Number_om_negative}},
-  {0x39a68c12, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x39a6a1d2, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x48dbf560, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x6701127b, 0x0bbdc76a, VTM_NATIVE  , 0, {(meat::method_ptr_t)Number_om_absolute}},
-  {0x6b2d9a7a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x7a8e569a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x7b840562, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x7d180801, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}}
+  {0x00000025, 0x0bbdc76a, VTM_NATIVE  , 1, {(meat::method_ptr_t)Number_om_mod}, 0},
+  {0x0000002a, 0x0bbdc76a, VTM_NATIVE  , 1, {(meat::method_ptr_t)Number_om_mult}, 0},
+  {0x0000002b, 0x0bbdc76a, VTM_NATIVE  , 1, {(meat::method_ptr_t)Number_om_add}, 0},
+  {0x0000002d, 0x0bbdc76a, VTM_NATIVE  , 1, {(meat::method_ptr_t)Number_om_sub}, 0},
+  {0x0000002f, 0x0bbdc76a, VTM_NATIVE  , 1, {(meat::method_ptr_t)Number_om_div}, 0},
+  {0x0000003c, 0x0bbdc76a, VTM_NATIVE  , 1, {(meat::method_ptr_t)Number_om_less}, 0},
+  {0x0000003e, 0x0bbdc76a, VTM_NATIVE  , 1, {(meat::method_ptr_t)Number_om_greater}, 0},
+  {0x0000005e, 0x0bbdc76a, VTM_NATIVE  , 1, {(meat::method_ptr_t)Number_om_pow}, 0},
+  {0x00000781, 0x0bbdc76a, VTM_NATIVE  , 1, {(meat::method_ptr_t)Number_om_less_equal}, 0},
+  {0x00000782, 0x0bbdc76a, VTM_NATIVE  , 1, {(meat::method_ptr_t)Number_om_nequals}, 0},
+  {0x000007a0, 0x0bbdc76a, VTM_NATIVE  , 1, {(meat::method_ptr_t)Number_om_equals}, 0},
+  {0x000007bf, 0x0bbdc76a, VTM_NATIVE  , 1, {(meat::method_ptr_t)Number_om_greater_equal}, 0},
+  {0x00019850, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x00368f3a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x00379f78, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x20be875b, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x24ab71da, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x2c025c80, 0x0bbdc76a, VTM_NATIVE  , 0, {(meat::method_ptr_t)Number_om_asText}, 0},
+  {0x331152ee, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x34003578, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x36e711e1, 0x0bbdc76a, VTM_NATIVE  , 0, {(meat::method_ptr_t)Number_om_negative}, 0},
+  {0x39a68c12, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x39a6a1d2, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x48dbf560, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x6701127b, 0x0bbdc76a, VTM_NATIVE  , 0, {(meat::method_ptr_t)Number_om_absolute}, 0},
+  {0x6b2d9a7a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x7a8e569a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x7b840562, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x7d180801, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0}
 };
 
 static meat::vtable_entry_t NumberCMethods[] = {
-  {0x00000782, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x000007a0, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x00019850, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x00368f3a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x068b6f7b, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x17cbc00b, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x20be875b, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x24ab71da, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x2ded23e0, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x39a68c12, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x39a6a1d2, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x54aa30e6, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x6b2d9a7a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x7a8e569a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x7b840562, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x7d180801, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}}
+  {0x00000782, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x000007a0, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x00019850, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x00368f3a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x068b6f7b, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x17cbc00b, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x20be875b, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x24ab71da, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x2ded23e0, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x39a68c12, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x39a6a1d2, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x54aa30e6, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x6b2d9a7a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x7a8e569a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x7b840562, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x7d180801, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0}
 };
 
 /******************************************************************************
@@ -1906,7 +1893,7 @@ static Reference Text_constructor(
   Reference &klass,
   std::uint8_t properties) {
 
-    return new Text(klass, properties);
+    return new (properties) Text(klass, properties);
   
 }
 
@@ -2027,11 +2014,11 @@ static Reference Text_om_findFirst_(Reference context) {
           (cast<Text>(self).compare(it.position(),
                                     cast<Text>(value).length(),
                                     cast<Text>(value)) == 0)) {
-        return new Value(index);
+        return Integer(index);
       }
     }
 
-    return new Value(0);
+    return Integer(0);
   }
 
 // method findFirst:at:
@@ -2061,11 +2048,11 @@ static Reference Text_om_findFirst_at_(Reference context) {
           (cast<Text>(self).compare(it.position(),
                                     cast<Text>(value).length(),
                                     cast<Text>(value)) == 0)) {
-        return new Value(result);
+        return Integer(result);
       }
     }
 
-    return new Value(0);
+    return Integer(0);
   }
 
 // method findLast:
@@ -2173,7 +2160,7 @@ static Reference Text_om_length(Reference context) {
     utf8::iterator it(cast<const Text>(self));
     for (; it != it.end(); ++it, ++length);
 
-    return new Value(length);
+    return Integer(length);
   }
 
 // method replaceAll:with:
@@ -2225,45 +2212,45 @@ static Reference Text_om_replaceFrom_count_with_(Reference context) {
   }
 
 static meat::vtable_entry_t TextMethods[] = {
-  {0x0000002a, 0x0027b94d, VTM_NATIVE  , 1, {(meat::method_ptr_t)Text_om_mult}},
-  {0x0000002b, 0x0027b94d, VTM_NATIVE  , 1, {(meat::method_ptr_t)Text_om_add}},
-  {0x0000003c, 0x0027b94d, VTM_NATIVE  , 1, {(meat::method_ptr_t)Text_om_less}},
-  {0x0000003e, 0x0027b94d, VTM_NATIVE  , 1, {(meat::method_ptr_t)Text_om_greater}},
-  {0x00000781, 0x0027b94d, VTM_NATIVE  , 1, {(meat::method_ptr_t)Text_om_less_equal}},
-  {0x00000782, 0x0027b94d, VTM_NATIVE  , 1, {(meat::method_ptr_t)Text_om_nequals}},
-  {0x000007a0, 0x0027b94d, VTM_NATIVE  , 1, {(meat::method_ptr_t)Text_om_equals}},
-  {0x000007bf, 0x0027b94d, VTM_NATIVE  , 1, {(meat::method_ptr_t)Text_om_greater_equal}},
-  {0x00019850, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x002eaf75, 0x0027b94d, VTM_NATIVE  , 0, {(meat::method_ptr_t)Text_om_copy}},
-  {0x00368f3a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x00379f78, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x018b0a25, 0x0027b94d, VTM_NATIVE  , 2, {(meat::method_ptr_t)Text_om_forEach_do_}},
-  {0x02b7e8da, 0x0027b94d, VTM_BYTECODE, 4, {(meat::method_ptr_t)0}},
-  {0x0fd97630, 0x0027b94d, VTM_NATIVE  , 3, {(meat::method_ptr_t)Text_om_replaceFrom_count_with_}},
-  {0x188f29d9, 0x0027b94d, VTM_NATIVE  , 1, {(meat::method_ptr_t)Text_om_findLast_}},
-  {0x18e824c4, 0x0027b94d, VTM_NATIVE  , 2, {(meat::method_ptr_t)Text_om_findFirst_at_}},
-  {0x20be875b, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x24ab71da, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x2b7c6b26, 0x0027b94d, VTM_NATIVE  , 0, {(meat::method_ptr_t)Text_om_asNumber}},
-  {0x2c025c80, 0x0027b94d, VTM_BYTECODE, 4, {(meat::method_ptr_t)9}},
-  {0x2eb56bfb, 0x0027b94d, VTM_BYTECODE, 4, {(meat::method_ptr_t)18}},
-  {0x3003ed09, 0x0027b94d, VTM_NATIVE  , 0, {(meat::method_ptr_t)Text_om_asInteger}},
-  {0x30c68f6a, 0x0027b94d, VTM_NATIVE  , 2, {(meat::method_ptr_t)Text_om_replaceAll_with_}},
-  {0x331152ee, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x34003578, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x39a68c12, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x39a6a1d2, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x3e0e3ae7, 0x0027b94d, VTM_NATIVE  , 0, {(meat::method_ptr_t)Text_om_length}},
-  {0x46a8bf3a, 0x0027b94d, VTM_NATIVE  , 2, {(meat::method_ptr_t)Text_om_getFrom_count_}},
-  {0x48dbf560, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x69eddf35, 0x0027b94d, VTM_NATIVE  , 1, {(meat::method_ptr_t)Text_om_getCharAt_}},
-  {0x6b2d9a7a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x6f8948ba, 0x0027b94d, VTM_NATIVE  , 1, {(meat::method_ptr_t)Text_om_findFirst_}},
-  {0x7a8e569a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x7aab326f, 0x0027b94d, VTM_NATIVE  , 0, {(meat::method_ptr_t)Text_om_isEmpty}},
-  {0x7b840562, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x7c186c41, 0x0027b94d, VTM_NATIVE  , 2, {(meat::method_ptr_t)Text_om_findLast_at_}},
-  {0x7d180801, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}}
+  {0x0000002a, 0x0027b94d, VTM_NATIVE  , 1, {(meat::method_ptr_t)Text_om_mult}, 0},
+  {0x0000002b, 0x0027b94d, VTM_NATIVE  , 1, {(meat::method_ptr_t)Text_om_add}, 0},
+  {0x0000003c, 0x0027b94d, VTM_NATIVE  , 1, {(meat::method_ptr_t)Text_om_less}, 0},
+  {0x0000003e, 0x0027b94d, VTM_NATIVE  , 1, {(meat::method_ptr_t)Text_om_greater}, 0},
+  {0x00000781, 0x0027b94d, VTM_NATIVE  , 1, {(meat::method_ptr_t)Text_om_less_equal}, 0},
+  {0x00000782, 0x0027b94d, VTM_NATIVE  , 1, {(meat::method_ptr_t)Text_om_nequals}, 0},
+  {0x000007a0, 0x0027b94d, VTM_NATIVE  , 1, {(meat::method_ptr_t)Text_om_equals}, 0},
+  {0x000007bf, 0x0027b94d, VTM_NATIVE  , 1, {(meat::method_ptr_t)Text_om_greater_equal}, 0},
+  {0x00019850, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x002eaf75, 0x0027b94d, VTM_NATIVE  , 0, {(meat::method_ptr_t)Text_om_copy}, 0},
+  {0x00368f3a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x00379f78, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x018b0a25, 0x0027b94d, VTM_NATIVE  , 2, {(meat::method_ptr_t)Text_om_forEach_do_}, 0},
+  {0x02b7e8da, 0x0027b94d, VTM_BYTECODE, 4, {(meat::method_ptr_t)0}, 0},
+  {0x0fd97630, 0x0027b94d, VTM_NATIVE  , 3, {(meat::method_ptr_t)Text_om_replaceFrom_count_with_}, 0},
+  {0x188f29d9, 0x0027b94d, VTM_NATIVE  , 1, {(meat::method_ptr_t)Text_om_findLast_}, 0},
+  {0x18e824c4, 0x0027b94d, VTM_NATIVE  , 2, {(meat::method_ptr_t)Text_om_findFirst_at_}, 0},
+  {0x20be875b, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x24ab71da, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x2b7c6b26, 0x0027b94d, VTM_NATIVE  , 0, {(meat::method_ptr_t)Text_om_asNumber}, 0},
+  {0x2c025c80, 0x0027b94d, VTM_BYTECODE, 4, {(meat::method_ptr_t)9}, 0},
+  {0x2eb56bfb, 0x0027b94d, VTM_BYTECODE, 4, {(meat::method_ptr_t)18}, 0},
+  {0x3003ed09, 0x0027b94d, VTM_NATIVE  , 0, {(meat::method_ptr_t)Text_om_asInteger}, 0},
+  {0x30c68f6a, 0x0027b94d, VTM_NATIVE  , 2, {(meat::method_ptr_t)Text_om_replaceAll_with_}, 0},
+  {0x331152ee, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x34003578, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x39a68c12, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x39a6a1d2, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x3e0e3ae7, 0x0027b94d, VTM_NATIVE  , 0, {(meat::method_ptr_t)Text_om_length}, 0},
+  {0x46a8bf3a, 0x0027b94d, VTM_NATIVE  , 2, {(meat::method_ptr_t)Text_om_getFrom_count_}, 0},
+  {0x48dbf560, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x69eddf35, 0x0027b94d, VTM_NATIVE  , 1, {(meat::method_ptr_t)Text_om_getCharAt_}, 0},
+  {0x6b2d9a7a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x6f8948ba, 0x0027b94d, VTM_NATIVE  , 1, {(meat::method_ptr_t)Text_om_findFirst_}, 0},
+  {0x7a8e569a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x7aab326f, 0x0027b94d, VTM_NATIVE  , 0, {(meat::method_ptr_t)Text_om_isEmpty}, 0},
+  {0x7b840562, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x7c186c41, 0x0027b94d, VTM_NATIVE  , 2, {(meat::method_ptr_t)Text_om_findLast_at_}, 0},
+  {0x7d180801, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0}
 };
 
 static std::uint8_t TextBytecode[] = {
@@ -2280,7 +2267,7 @@ static Reference List_constructor(
   Reference &klass,
   std::uint8_t properties) {
 
-    return new List(klass, properties);
+    return new (properties) List(klass, properties);
   
 }
 
@@ -2290,7 +2277,7 @@ static Reference List_om_append_(Reference context) {
   Reference klass = cast<Context>(context).klass();
   Reference value = cast<Context>(context).parameter(0);
 
-    if (value->is_type(meat::Class::resolve("List"))) {
+    if (is_type(value, meat::Class::core(meat::CORE_LIST))) {
       cast<List>(self).insert(cast<List>(self).end(),
                               cast<List>(value).begin(),
                               cast<List>(value).end());
@@ -2335,7 +2322,7 @@ static Reference List_om_entries(Reference context) {
   Reference self = cast<Context>(context).self();
   Reference klass = cast<Context>(context).klass();
 
-    return new Value((int32_t)(cast<List>(self).size()));
+    return Integer((int32_t)(cast<List>(self).size()));
   }
 
 // method forEach:do:
@@ -2345,15 +2332,18 @@ static Reference List_om_forEach_do_(Reference context) {
   Reference _item = cast<Context>(context).parameter(0);
   Reference block = cast<Context>(context).parameter(1);
 
-    cast<Context>(block).messenger(context);
+    Context &ctx = cast<Context>(context);
+    List &list = cast<List>(self);
+    std::uint32_t index = ctx.step();
+    if (index > 0) {
+      if (cast<BlockContext>(block).break_called()) return null;
+      cast<BlockContext>(block).reset();
+    }
 
-    for (auto &item: cast<List>(self)) {
+    if (index < list.size()) {
       cast<BlockContext>(block).set_break_trap();
-      cast<BlockParameter>(_item).set_parameter(item);
-      execute(block);
-
-      if (cast<BlockContext>(block).break_called()) break;
-      else cast<BlockContext>(block).reset();
+      cast<BlockParameter>(_item).set_parameter(list[index]);
+      return ctx.invoke(block);
     }
 
     return null;
@@ -2514,60 +2504,60 @@ static Reference List_om_swap_with_(Reference context) {
   }
 
 static meat::vtable_entry_t ListMethods[] = {
-  {0x00000782, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x000007a0, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x00019850, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x0001b251, 0x002424be, VTM_NATIVE  , 0, {(meat::method_ptr_t)List_om_pop}},
-  {0x002eaf75, 0x002424be, VTM_NATIVE  , 0, {(meat::method_ptr_t)List_om_copy}},
-  {0x00305ba4, 0x002424be, VTM_NATIVE  , 1, {(meat::method_ptr_t)List_om_get_}},
-  {0x00329296, 0x002424be, VTM_NATIVE  , 0, {(meat::method_ptr_t)List_om_last}},
-  {0x0035f59e, 0x002424be, VTM_NATIVE  , 0, {(meat::method_ptr_t)List_om_sort}},
-  {0x00368f3a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x00379f78, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x018b0a25, 0x002424be, VTM_NATIVE  , 2, {(meat::method_ptr_t)List_om_forEach_do_}},
-  {0x05a5b64d, 0x002424be, VTM_NATIVE  , 0, {(meat::method_ptr_t)List_om_clear}},
-  {0x05d2de29, 0x002424be, VTM_NATIVE  , 0, {(meat::method_ptr_t)List_om_front}},
-  {0x06613460, 0x002424be, VTM_NATIVE  , 1, {(meat::method_ptr_t)List_om_push_}},
-  {0x12b51eb5, 0x002424be, VTM_NATIVE  , 2, {(meat::method_ptr_t)List_om_removeFrom_to_}},
-  {0x13a72bf2, 0x002424be, VTM_NATIVE  , 2, {(meat::method_ptr_t)List_om_swap_with_}},
-  {0x20be875b, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x212284bb, 0x002424be, VTM_NATIVE  , 0, {(meat::method_ptr_t)List_om_entries}},
-  {0x24ab71da, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x25860c22, 0x002424be, VTM_NATIVE  , 0, {(meat::method_ptr_t)List_om_popFront}},
-  {0x331152ee, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x34003578, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x39a68c12, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x39a6a1d2, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x3c94d873, 0x002424be, VTM_NATIVE  , 2, {(meat::method_ptr_t)List_om_at_insert_}},
-  {0x41141866, 0x002424be, VTM_NATIVE  , 1, {(meat::method_ptr_t)List_om_remove_}},
-  {0x48dbf560, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x491b0cd1, 0x002424be, VTM_NATIVE  , 1, {(meat::method_ptr_t)List_om_pushFront_}},
-  {0x4c6fc15b, 0x002424be, VTM_NATIVE  , 1, {(meat::method_ptr_t)List_om_removeAt_}},
-  {0x50b51489, 0x002424be, VTM_NATIVE  , 1, {(meat::method_ptr_t)List_om_append_}},
-  {0x6b2d9a7a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x7644da37, 0x002424be, VTM_NATIVE  , 2, {(meat::method_ptr_t)List_om_set_to_}},
-  {0x7a8e569a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x7aab326f, 0x002424be, VTM_NATIVE  , 0, {(meat::method_ptr_t)List_om_isEmpty}},
-  {0x7b840562, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x7d180801, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}}
+  {0x00000782, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x000007a0, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x00019850, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x0001b251, 0x002424be, VTM_NATIVE  , 0, {(meat::method_ptr_t)List_om_pop}, 0},
+  {0x002eaf75, 0x002424be, VTM_NATIVE  , 0, {(meat::method_ptr_t)List_om_copy}, 0},
+  {0x00305ba4, 0x002424be, VTM_NATIVE  , 1, {(meat::method_ptr_t)List_om_get_}, 0},
+  {0x00329296, 0x002424be, VTM_NATIVE  , 0, {(meat::method_ptr_t)List_om_last}, 0},
+  {0x0035f59e, 0x002424be, VTM_NATIVE  , 0, {(meat::method_ptr_t)List_om_sort}, 0},
+  {0x00368f3a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x00379f78, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x018b0a25, 0x002424be, VTM_NATIVE  , 2, {(meat::method_ptr_t)List_om_forEach_do_}, 0},
+  {0x05a5b64d, 0x002424be, VTM_NATIVE  , 0, {(meat::method_ptr_t)List_om_clear}, 0},
+  {0x05d2de29, 0x002424be, VTM_NATIVE  , 0, {(meat::method_ptr_t)List_om_front}, 0},
+  {0x06613460, 0x002424be, VTM_NATIVE  , 1, {(meat::method_ptr_t)List_om_push_}, 0},
+  {0x12b51eb5, 0x002424be, VTM_NATIVE  , 2, {(meat::method_ptr_t)List_om_removeFrom_to_}, 0},
+  {0x13a72bf2, 0x002424be, VTM_NATIVE  , 2, {(meat::method_ptr_t)List_om_swap_with_}, 0},
+  {0x20be875b, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x212284bb, 0x002424be, VTM_NATIVE  , 0, {(meat::method_ptr_t)List_om_entries}, 0},
+  {0x24ab71da, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x25860c22, 0x002424be, VTM_NATIVE  , 0, {(meat::method_ptr_t)List_om_popFront}, 0},
+  {0x331152ee, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x34003578, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x39a68c12, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x39a6a1d2, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x3c94d873, 0x002424be, VTM_NATIVE  , 2, {(meat::method_ptr_t)List_om_at_insert_}, 0},
+  {0x41141866, 0x002424be, VTM_NATIVE  , 1, {(meat::method_ptr_t)List_om_remove_}, 0},
+  {0x48dbf560, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x491b0cd1, 0x002424be, VTM_NATIVE  , 1, {(meat::method_ptr_t)List_om_pushFront_}, 0},
+  {0x4c6fc15b, 0x002424be, VTM_NATIVE  , 1, {(meat::method_ptr_t)List_om_removeAt_}, 0},
+  {0x50b51489, 0x002424be, VTM_NATIVE  , 1, {(meat::method_ptr_t)List_om_append_}, 0},
+  {0x6b2d9a7a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x7644da37, 0x002424be, VTM_NATIVE  , 2, {(meat::method_ptr_t)List_om_set_to_}, 0},
+  {0x7a8e569a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x7aab326f, 0x002424be, VTM_NATIVE  , 0, {(meat::method_ptr_t)List_om_isEmpty}, 0},
+  {0x7b840562, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x7d180801, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0}
 };
 
 static meat::vtable_entry_t ListCMethods[] = {
-  {0x00000782, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x000007a0, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x00019850, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x0001a9a0, 0x002424be, VTM_BYTECODE, 4, {(meat::method_ptr_t)0}},
-  {0x00368f3a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x068b6f7b, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x20be875b, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x24ab71da, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x39a68c12, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x39a6a1d2, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x54aa30e6, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x6b2d9a7a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x7a8e569a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x7b840562, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x7d180801, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}}
+  {0x00000782, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x000007a0, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x00019850, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x0001a9a0, 0x002424be, VTM_BYTECODE, 4, {(meat::method_ptr_t)0}, 0},
+  {0x00368f3a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x068b6f7b, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x20be875b, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x24ab71da, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x39a68c12, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x39a6a1d2, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x54aa30e6, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x6b2d9a7a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x7a8e569a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x7b840562, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x7d180801, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0}
 };
 
 static std::uint8_t ListBytecode[] = {
@@ -2583,7 +2573,7 @@ static Reference Set_constructor(
   Reference &klass,
   std::uint8_t properties) {
 
-    return new Set(klass, properties);
+    return new (properties) Set(klass, properties);
   
 }
 
@@ -2610,7 +2600,7 @@ static Reference Set_om_entries(Reference context) {
   Reference self = cast<Context>(context).self();
   Reference klass = cast<Context>(context).klass();
 
-    return new Value((std::int32_t)cast<Set>(self).size());
+    return Integer((std::int32_t)cast<Set>(self).size());
   }
 
 // method forEach:do:
@@ -2693,49 +2683,49 @@ static Reference Set_om_swap_(Reference context) {
   }
 
 static meat::vtable_entry_t SetMethods[] = {
-  {0x00000782, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x000007a0, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x00019850, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x002eaf75, 0x00014442, VTM_NATIVE  , 0, {(meat::method_ptr_t)Set_om_copy}},
-  {0x00368f3a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x00379f78, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x018b0a25, 0x00014442, VTM_NATIVE  , 2, {(meat::method_ptr_t)Set_om_forEach_do_}},
-  {0x05a5b64d, 0x00014442, VTM_NATIVE  , 0, {(meat::method_ptr_t)Set_om_clear}},
-  {0x068c2107, 0x00014442, VTM_NATIVE  , 1, {(meat::method_ptr_t)Set_om_swap_}},
-  {0x20be875b, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x212284bb, 0x00014442, VTM_NATIVE  , 0, {(meat::method_ptr_t)Set_om_entries}},
-  {0x24ab71da, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x331152ee, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x34003578, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x39a68c12, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x39a6a1d2, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x41141866, 0x00014442, VTM_NATIVE  , 1, {(meat::method_ptr_t)Set_om_remove_}},
-  {0x48dbf560, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x578f4fa5, 0x00014442, VTM_NATIVE  , 1, {(meat::method_ptr_t)Set_om_hasEntry_}},
-  {0x6b2d9a7a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x74a794cd, 0x00014442, VTM_NATIVE  , 1, {(meat::method_ptr_t)Set_om_insert_}},
-  {0x7a8e569a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x7aab326f, 0x00014442, VTM_NATIVE  , 0, {(meat::method_ptr_t)Set_om_isEmpty}},
-  {0x7b840562, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x7d180801, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}}
+  {0x00000782, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x000007a0, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x00019850, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x002eaf75, 0x00014442, VTM_NATIVE  , 0, {(meat::method_ptr_t)Set_om_copy}, 0},
+  {0x00368f3a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x00379f78, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x018b0a25, 0x00014442, VTM_NATIVE  , 2, {(meat::method_ptr_t)Set_om_forEach_do_}, 0},
+  {0x05a5b64d, 0x00014442, VTM_NATIVE  , 0, {(meat::method_ptr_t)Set_om_clear}, 0},
+  {0x068c2107, 0x00014442, VTM_NATIVE  , 1, {(meat::method_ptr_t)Set_om_swap_}, 0},
+  {0x20be875b, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x212284bb, 0x00014442, VTM_NATIVE  , 0, {(meat::method_ptr_t)Set_om_entries}, 0},
+  {0x24ab71da, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x331152ee, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x34003578, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x39a68c12, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x39a6a1d2, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x41141866, 0x00014442, VTM_NATIVE  , 1, {(meat::method_ptr_t)Set_om_remove_}, 0},
+  {0x48dbf560, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x578f4fa5, 0x00014442, VTM_NATIVE  , 1, {(meat::method_ptr_t)Set_om_hasEntry_}, 0},
+  {0x6b2d9a7a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x74a794cd, 0x00014442, VTM_NATIVE  , 1, {(meat::method_ptr_t)Set_om_insert_}, 0},
+  {0x7a8e569a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x7aab326f, 0x00014442, VTM_NATIVE  , 0, {(meat::method_ptr_t)Set_om_isEmpty}, 0},
+  {0x7b840562, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x7d180801, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0}
 };
 
 static meat::vtable_entry_t SetCMethods[] = {
-  {0x00000782, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x000007a0, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x00019850, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x0001a9a0, 0x00014442, VTM_BYTECODE, 4, {(meat::method_ptr_t)0}},
-  {0x00368f3a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x068b6f7b, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x20be875b, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x24ab71da, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x39a68c12, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x39a6a1d2, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x54aa30e6, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x6b2d9a7a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x7a8e569a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x7b840562, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x7d180801, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}}
+  {0x00000782, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x000007a0, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x00019850, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x0001a9a0, 0x00014442, VTM_BYTECODE, 4, {(meat::method_ptr_t)0}, 0},
+  {0x00368f3a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x068b6f7b, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x20be875b, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x24ab71da, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x39a68c12, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x39a6a1d2, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x54aa30e6, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x6b2d9a7a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x7a8e569a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x7b840562, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x7d180801, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0}
 };
 
 static std::uint8_t SetBytecode[] = {
@@ -2751,7 +2741,7 @@ static Reference Index_constructor(
   Reference &klass,
   std::uint8_t properties) {
 
-    return new Index(klass, properties);
+    return new (properties) Index(klass, properties);
   
 }
 
@@ -2770,7 +2760,7 @@ static Reference Index_om_entries(Reference context) {
   Reference klass = cast<Context>(context).klass();
 
     std::int32_t size = cast<Index>(self).size();
-    return new Value(size);
+    return Integer(size);
   }
 
 // method get:
@@ -2824,47 +2814,47 @@ static Reference Index_om_set_to_(Reference context) {
   }
 
 static meat::vtable_entry_t IndexMethods[] = {
-  {0x00000782, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x000007a0, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x00019850, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x002eaf75, 0x043838b2, VTM_NATIVE  , 0, {(meat::method_ptr_t)Index_om_copy}},
-  {0x00305ba4, 0x043838b2, VTM_NATIVE  , 1, {(meat::method_ptr_t)Index_om_get_}},
-  {0x0030c0e0, 0x043838b2, VTM_NATIVE  , 1, {(meat::method_ptr_t)Index_om_has_}},
-  {0x00368f3a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x00379f78, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x20be875b, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x212284bb, 0x043838b2, VTM_NATIVE  , 0, {(meat::method_ptr_t)Index_om_entries}},
-  {0x24ab71da, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x331152ee, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x34003578, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x39a68c12, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x39a6a1d2, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x41141866, 0x043838b2, VTM_NATIVE  , 1, {(meat::method_ptr_t)Index_om_remove_}},
-  {0x48dbf560, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x6b2d9a7a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x7644da37, 0x043838b2, VTM_NATIVE  , 2, {(meat::method_ptr_t)Index_om_set_to_}},
-  {0x7a8e569a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x7aab326f, 0x043838b2, VTM_NATIVE  , 0, {(meat::method_ptr_t)Index_om_isEmpty}},
-  {0x7b840562, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x7d180801, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}}
+  {0x00000782, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x000007a0, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x00019850, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x002eaf75, 0x043838b2, VTM_NATIVE  , 0, {(meat::method_ptr_t)Index_om_copy}, 0},
+  {0x00305ba4, 0x043838b2, VTM_NATIVE  , 1, {(meat::method_ptr_t)Index_om_get_}, 0},
+  {0x0030c0e0, 0x043838b2, VTM_NATIVE  , 1, {(meat::method_ptr_t)Index_om_has_}, 0},
+  {0x00368f3a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x00379f78, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x20be875b, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x212284bb, 0x043838b2, VTM_NATIVE  , 0, {(meat::method_ptr_t)Index_om_entries}, 0},
+  {0x24ab71da, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x331152ee, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x34003578, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x39a68c12, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x39a6a1d2, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x41141866, 0x043838b2, VTM_NATIVE  , 1, {(meat::method_ptr_t)Index_om_remove_}, 0},
+  {0x48dbf560, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x6b2d9a7a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x7644da37, 0x043838b2, VTM_NATIVE  , 2, {(meat::method_ptr_t)Index_om_set_to_}, 0},
+  {0x7a8e569a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x7aab326f, 0x043838b2, VTM_NATIVE  , 0, {(meat::method_ptr_t)Index_om_isEmpty}, 0},
+  {0x7b840562, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x7d180801, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0}
 };
 
 static meat::vtable_entry_t IndexCMethods[] = {
-  {0x00000782, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x000007a0, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x00019850, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x0001a9a0, 0x043838b2, VTM_BYTECODE, 4, {(meat::method_ptr_t)0}},
-  {0x00368f3a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x068b6f7b, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x20be875b, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x24ab71da, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x39a68c12, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x39a6a1d2, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x54aa30e6, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x6b2d9a7a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x7a8e569a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x7b840562, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x7d180801, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}}
+  {0x00000782, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x000007a0, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x00019850, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x0001a9a0, 0x043838b2, VTM_BYTECODE, 4, {(meat::method_ptr_t)0}, 0},
+  {0x00368f3a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x068b6f7b, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x20be875b, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x24ab71da, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x39a68c12, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x39a6a1d2, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x54aa30e6, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x6b2d9a7a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x7a8e569a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x7b840562, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x7d180801, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0}
 };
 
 static std::uint8_t IndexBytecode[] = {
@@ -2877,23 +2867,23 @@ static std::uint8_t IndexBytecode[] = {
  */
 
 static meat::vtable_entry_t ApplicationMethods[] = {
-  {0x00000782, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x000007a0, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x00019850, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x00368f3a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x00379f78, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x05c30872, 0x419df72b, VTM_BYTECODE, 6, {(meat::method_ptr_t)0}},
-  {0x20be875b, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x24ab71da, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x331152ee, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x34003578, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x39a68c12, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x39a6a1d2, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x48dbf560, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x6b2d9a7a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x7a8e569a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x7b840562, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x7d180801, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}}
+  {0x00000782, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x000007a0, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x00019850, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x00368f3a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x00379f78, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x05c30872, 0x419df72b, VTM_BYTECODE, 6, {(meat::method_ptr_t)0}, 0},
+  {0x20be875b, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x24ab71da, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x331152ee, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x34003578, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x39a68c12, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x39a6a1d2, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x48dbf560, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x6b2d9a7a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x7a8e569a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x7b840562, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x7d180801, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0}
 };
 
 // class method getEnviron:
@@ -2947,28 +2937,28 @@ static Reference Application_cm_parameters(Reference context) {
   Reference self = cast<Context>(context).self();
   Reference klass = cast<Context>(context).klass();
 
-    return new meat::Value((std::int32_t)arg_count());
+    return meat::Integer((std::int32_t)arg_count());
   }
 
 static meat::vtable_entry_t ApplicationCMethods[] = {
-  {0x00000782, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x000007a0, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x00019850, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x00368f3a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x0462f057, 0x419df72b, VTM_NATIVE  , 1, {(meat::method_ptr_t)Application_cm_getEnviron_}},
-  {0x05c30872, 0x419df72b, VTM_BYTECODE, 6, {(meat::method_ptr_t)61}},
-  {0x068b6f7b, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x1b6d6881, 0x419df72b, VTM_NATIVE  , 1, {(meat::method_ptr_t)Application_cm_parameter_}},
-  {0x1b6d68ba, 0x419df72b, VTM_NATIVE  , 0, {(meat::method_ptr_t)Application_cm_parameters}},
-  {0x20be875b, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x24ab71da, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x39a68c12, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x39a6a1d2, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x54aa30e6, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x6b2d9a7a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x7a8e569a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x7b840562, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x7d180801, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}}
+  {0x00000782, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x000007a0, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x00019850, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x00368f3a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x0462f057, 0x419df72b, VTM_NATIVE  , 1, {(meat::method_ptr_t)Application_cm_getEnviron_}, 0},
+  {0x05c30872, 0x419df72b, VTM_BYTECODE, 6, {(meat::method_ptr_t)61}, 0},
+  {0x068b6f7b, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x1b6d6881, 0x419df72b, VTM_NATIVE  , 1, {(meat::method_ptr_t)Application_cm_parameter_}, 0},
+  {0x1b6d68ba, 0x419df72b, VTM_NATIVE  , 0, {(meat::method_ptr_t)Application_cm_parameters}, 0},
+  {0x20be875b, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x24ab71da, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x39a68c12, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x39a6a1d2, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x54aa30e6, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x6b2d9a7a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x7a8e569a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x7b840562, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x7d180801, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0}
 };
 
 static std::uint8_t ApplicationBytecode[] = {
@@ -3028,26 +3018,26 @@ static Reference Archive_om_sync(Reference context) {
   }
 
 static meat::vtable_entry_t ArchiveMethods[] = {
-  {0x00000782, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x000007a0, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x00019850, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x00361a9b, 0x36a178be, VTM_NATIVE  , 0, {(meat::method_ptr_t)Archive_om_sync}},
-  {0x00368f3a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x00379f78, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x20be875b, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x24ab71da, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x28186b3f, 0x36a178be, VTM_NATIVE  , 0, {(meat::method_ptr_t)Archive_om_getObject}},
-  {0x29950066, 0x36a178be, VTM_NATIVE  , 1, {(meat::method_ptr_t)Archive_om_requires_}},
-  {0x331152ee, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x34003578, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x39a68c12, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x39a6a1d2, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x48dbf560, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x4e688b77, 0x36a178be, VTM_NATIVE  , 1, {(meat::method_ptr_t)Archive_om_setObject_}},
-  {0x6b2d9a7a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x7a8e569a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x7b840562, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x7d180801, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}}
+  {0x00000782, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x000007a0, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x00019850, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x00361a9b, 0x36a178be, VTM_NATIVE  , 0, {(meat::method_ptr_t)Archive_om_sync}, 0},
+  {0x00368f3a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x00379f78, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x20be875b, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x24ab71da, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x28186b3f, 0x36a178be, VTM_NATIVE  , 0, {(meat::method_ptr_t)Archive_om_getObject}, 0},
+  {0x29950066, 0x36a178be, VTM_NATIVE  , 1, {(meat::method_ptr_t)Archive_om_requires_}, 0},
+  {0x331152ee, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x34003578, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x39a68c12, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x39a6a1d2, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x48dbf560, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x4e688b77, 0x36a178be, VTM_NATIVE  , 1, {(meat::method_ptr_t)Archive_om_setObject_}, 0},
+  {0x6b2d9a7a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x7a8e569a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x7b840562, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x7d180801, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0}
 };
 
 // class method create:
@@ -3069,22 +3059,22 @@ static Reference Archive_cm_open_(Reference context) {
   }
 
 static meat::vtable_entry_t ArchiveCMethods[] = {
-  {0x00000782, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x000007a0, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x00019850, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x00368f3a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x0650a330, 0x36a178be, VTM_NATIVE  , 1, {(meat::method_ptr_t)Archive_cm_open_}},
-  {0x068b6f7b, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x20be875b, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x24ab71da, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x39a68c12, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x39a6a1d2, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x3d4e7ee8, 0x36a178be, VTM_NATIVE  , 1, {(meat::method_ptr_t)Archive_cm_create_}},
-  {0x54aa30e6, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x6b2d9a7a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x7a8e569a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x7b840562, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x7d180801, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}}
+  {0x00000782, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x000007a0, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x00019850, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x00368f3a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x0650a330, 0x36a178be, VTM_NATIVE  , 1, {(meat::method_ptr_t)Archive_cm_open_}, 0},
+  {0x068b6f7b, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x20be875b, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x24ab71da, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x39a68c12, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x39a6a1d2, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x3d4e7ee8, 0x36a178be, VTM_NATIVE  , 1, {(meat::method_ptr_t)Archive_cm_create_}, 0},
+  {0x54aa30e6, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x6b2d9a7a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x7a8e569a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x7b840562, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x7d180801, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0}
 };
 
 /******************************************************************************
@@ -3095,7 +3085,7 @@ static Reference Library_constructor(
   Reference &klass,
   std::uint8_t properties) {
 
-    return new data::Library(klass, properties);
+    return new (properties) data::Library(klass, properties);
   
 }
 
@@ -3108,25 +3098,25 @@ static Reference Library_constructor(
 #define _paths (klass->property(1))
 
 static meat::vtable_entry_t LibraryMethods[] = {
-  {0x0000003c, 0x6d20bcbb, VTM_BYTECODE, 8, {(meat::method_ptr_t)0}},
-  {0x00000782, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x000007a0, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x00019850, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x00368f3a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x00379f78, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x20be875b, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x24ab71da, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x331152ee, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x34003578, 0x6d20bcbb, VTM_BYTECODE, 7, {(meat::method_ptr_t)61}},
-  {0x39a68c12, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x39a6a1d2, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x48dbf560, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x6b2d9a7a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x70c2702a, 0x6d20bcbb, VTM_BYTECODE, 6, {(meat::method_ptr_t)29}},
-  {0x7a8e569a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x7b82e32c, 0x6d20bcbb, VTM_BYTECODE, 5, {(meat::method_ptr_t)49}},
-  {0x7b840562, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x7d180801, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}}
+  {0x0000003c, 0x6d20bcbb, VTM_BYTECODE, 8, {(meat::method_ptr_t)0}, 0},
+  {0x00000782, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x000007a0, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x00019850, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x00368f3a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x00379f78, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x20be875b, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x24ab71da, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x331152ee, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x34003578, 0x6d20bcbb, VTM_BYTECODE, 7, {(meat::method_ptr_t)61}, 0},
+  {0x39a68c12, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x39a6a1d2, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x48dbf560, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x6b2d9a7a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x70c2702a, 0x6d20bcbb, VTM_BYTECODE, 6, {(meat::method_ptr_t)29}, 0},
+  {0x7a8e569a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x7b82e32c, 0x6d20bcbb, VTM_BYTECODE, 5, {(meat::method_ptr_t)49}, 0},
+  {0x7b840562, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x7d180801, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0}
 };
 
 #undef _name
@@ -3198,25 +3188,25 @@ static Reference Library_cm_setApplicationClass_(Reference context) {
   }
 
 static meat::vtable_entry_t LibraryCMethods[] = {
-  {0x00000782, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x000007a0, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x00019850, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x00368f3a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x05614602, 0x6d20bcbb, VTM_NATIVE  , 1, {(meat::method_ptr_t)Library_cm_include_}},
-  {0x068b6f7b, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x20be875b, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x24ab71da, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x29950066, 0x6d20bcbb, VTM_NATIVE  , 1, {(meat::method_ptr_t)Library_cm_requires_}},
-  {0x34003578, 0x6d20bcbb, VTM_BYTECODE, 7, {(meat::method_ptr_t)119}},
-  {0x39a68c12, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x39a6a1d2, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x54aa30e6, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x645271d8, 0x6d20bcbb, VTM_NATIVE  , 1, {(meat::method_ptr_t)Library_cm_setApplicationClass_}},
-  {0x6b2d9a7a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x72cd0161, 0x6d20bcbb, VTM_NATIVE  , 1, {(meat::method_ptr_t)Library_cm_import_}},
-  {0x7a8e569a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x7b840562, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}},
-  {0x7d180801, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}}
+  {0x00000782, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x000007a0, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x00019850, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x00368f3a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x05614602, 0x6d20bcbb, VTM_NATIVE  , 1, {(meat::method_ptr_t)Library_cm_include_}, 0},
+  {0x068b6f7b, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x20be875b, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x24ab71da, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x29950066, 0x6d20bcbb, VTM_NATIVE  , 1, {(meat::method_ptr_t)Library_cm_requires_}, 0},
+  {0x34003578, 0x6d20bcbb, VTM_BYTECODE, 7, {(meat::method_ptr_t)119}, 0},
+  {0x39a68c12, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x39a6a1d2, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x54aa30e6, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x645271d8, 0x6d20bcbb, VTM_NATIVE  , 1, {(meat::method_ptr_t)Library_cm_setApplicationClass_}, 0},
+  {0x6b2d9a7a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x72cd0161, 0x6d20bcbb, VTM_NATIVE  , 1, {(meat::method_ptr_t)Library_cm_import_}, 0},
+  {0x7a8e569a, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x7b840562, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0},
+  {0x7d180801, 0x00000000, VTM_SUPER   , 0, {(meat::method_ptr_t)0}, 0}
 };
 
 #undef _registry
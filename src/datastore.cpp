@@ -23,6 +23,8 @@
 #include <cstring>
 #include <fstream>
 #include <cmath>
+#include <iterator>
+#include <unordered_map>
 #include <unistd.h>
 
 #ifdef TESTING
@@ -121,7 +123,7 @@ int meat::data::fl_type(const std::string &fname) {
  ********************************/
 
 meat::data::Library::Library(const std::string &name)
-  : Object(Class::resolve("Library"), 4), is_native(false), dlhandle(nullptr) {
+  : Object(Class::core(CORE_LIBRARY), 4), is_native(false), dlhandle(nullptr) {
 
   _requirements = new List;
   _classes = new List;
@@ -325,7 +327,7 @@ void meat::data::Library::set_symbols(std::uint8_t *symbols) {
   // Build symbol index table.
   const char *sym = (const char *)symbols;
   while (*sym != 0) {
-    Reference hash_id = new Value((int32_t)hash(sym));
+    Reference hash_id = Integer((int32_t)hash(sym));
     cast<Index>(_symbols)[hash_id] = new Text(sym);
     sym += std::strlen(sym) + 1;
   }
@@ -336,7 +338,7 @@ void meat::data::Library::set_symbols(std::uint8_t *symbols) {
  *******************************/
 
 std::string meat::data::Library::lookup(std::uint32_t hash_id) const {
-  Reference _hash_id = new Value((int32_t)hash_id);
+  Reference _hash_id = Integer((int32_t)hash_id);
   auto it = cast<Index>(_symbols).find(_hash_id);
   if (it != cast<Index>(_symbols).end()) return cast<Text>(it->second);
   return itohex(hash_id);
@@ -403,7 +405,7 @@ void meat::data::Library::import_from_archive(const std::string &name) {
             << (int)class_cnt << " classes" << std::endl;
 #endif
   for (unsigned int cc = 0; cc < class_cnt; cc++) {
-    Reference cls = meat::Class::import(lib_file);
+    Reference cls = meat::Class::import(lib_file, header.minor_ver);
     cast<List>(_classes).push_back(cls);
     Class::record(cls);
     cast<Class>(cls).library = this;
@@ -476,7 +478,7 @@ typedef struct __attribute__((packed)) _meat_arch_header_s {
  ********************************/
 
 meat::data::Archive::Archive(const std::string &filename, bool create)
-  : Object(Class::resolve("Archive")), name(filename), create(create)  {
+  : Object(Class::core(CORE_ARCHIVE)), name(filename), create(create)  {
   synced = false;
   if (!this->create) {
 
@@ -587,7 +589,7 @@ void meat::data::Archive::set_object(Reference &object) {
 
     Index new_index;
     new_index.object = object;
-    new_index.cls_id = cast<Class>(object->type()).hash_id();
+    new_index.cls_id = cast<Class>(type_of(object)).hash_id();
 
     index.clear();
     index.push_back(new_index);
@@ -626,7 +628,7 @@ std::uint32_t meat::data::Archive::add_property(Reference property) {
       /* Add the object to the index and return the index offset. */
       Index new_index;
       new_index.object = property.weak();
-      new_index.cls_id = cast<Class>(property->type()).hash_id();
+      new_index.cls_id = cast<Class>(type_of(property)).hash_id();
       index.push_back(new_index);
       return index.size() - 1;
     }
@@ -764,6 +766,12 @@ meat::Reference meat::data::Archive::get_object(uint32_t index) {
 
   obj->unserialize(*this, data_stream);
 
+  // Integers are loaded back as immediate values.
+  if (obj_class == Class::core(CORE_INTEGER)) {
+    obj = Integer(INTEGER(obj));
+    this->index.at(index).object = obj;
+  }
+
   data_stream.seekg(save_pos);
   return obj;
 }
@@ -806,16 +814,22 @@ void meat::data::Archive::sync() {
 
       // Now serialize any object data to the file
       if (!(index[c].object.is_null())) {
-        uint8_t props = index[c].object->properties();
+        /*  Immediate Integers aren't objects, they're written out as a
+         * Value of their own.
+         */
+        Reference object = index[c].object;
+        if (object.is_immediate()) object = new Value(INTEGER(object));
+
+        uint8_t props = object->properties();
 
 #ifdef TESTING
         meat::test::test("Serializing number of properties", false);
-        if (props != cast<Class>(index[c].object->type()).obj_properties()) {
+        if (props != cast<Class>(object->type()).obj_properties()) {
           meat::test::failed("Serializing number of properties", false);
 #ifdef DEBUG
           std::cout << "      " << std::dec << (unsigned int)props << " != "
-                    << (unsigned int)cast<Class>(index[c].object->type()).obj_properties()
-                    << " for type " << cast<Class>(index[c].object->type())
+                    << (unsigned int)cast<Class>(object->type()).obj_properties()
+                    << " for type " << cast<Class>(object->type())
                     << std::endl;
 #endif
         }
@@ -824,17 +838,17 @@ void meat::data::Archive::sync() {
         // Now add the properties to the index and record the index offset.
         for (uint8_t i = 0; i < props; i++) {
           uint32_t idx =
-            endian::write_be(add_property((index[c].object)->property(i)));
+            endian::write_be(add_property(object->property(i)));
           data_stream.write((char *)&idx, 4);
 
-          if ((index[c].object)->property(i).is_weak())
+          if (object->property(i).is_weak())
             data_stream.put(OBJECT_PROP_WEAK);
           else
             data_stream.put(OBJECT_PROP);
         }
 
         // Now add any binary object data
-        index[c].object->serialize(*this, data_stream);
+        object->serialize(*this, data_stream);
       } else
         index[c].obj_offset = 0;
     }
@@ -1031,3 +1045,136 @@ meat::data::Archive &meat::data::operator <<(meat::data::Archive &archive,
 
   return archive;
 }
+
+/******************************************************************************
+ * Heap snapshots
+ */
+
+/* Within the file
+ *  Header
+ *  Classes
+ *   hash id
+ *   name
+ *  Objects
+ *   class hash id
+ *   size
+ *   flags
+ *   references
+ *   index of each object referenced
+ */
+
+#define SNAPSHOT_CLASS_ROOT   0x01 // The object is a recorded class.
+#define SNAPSHOT_CONTEXT_ROOT 0x02 // The object is the active context.
+#define SNAPSHOT_CLASS        0x04 // The object is a class, its hash id is
+                                   // given rather than its type's.
+
+/*****************************
+ * meat::data::heap_snapshot *
+ *****************************/
+
+void meat::data::heap_snapshot(const std::string &filename,
+                               Reference context) {
+  /*  Numbers the objects in the order they're found and collects the
+   * references of the object being traced. Acyclic objects are visited too,
+   * since they're part of the heap even if they can't be part of a cycle.
+   */
+  class walker : public memory::collectable::tracer {
+  public:
+    walker() : tracer(true) {}
+
+    std::uint32_t add(memory::collectable *obj) {
+      auto entry = ids.find(obj);
+      if (entry != ids.end()) return entry->second;
+
+      std::uint32_t id = objects.size();
+      ids[obj] = id;
+      objects.push_back(static_cast<Object *>(obj));
+      flags.push_back(0);
+      return id;
+    }
+
+    std::vector<Object *> objects;
+    std::vector<std::uint8_t> flags;
+    std::vector<std::uint32_t> edges;
+
+  protected:
+    virtual void visit(memory::collectable *obj) {
+      edges.push_back(add(obj));
+    }
+
+  private:
+    std::unordered_map<memory::collectable *, std::uint32_t> ids;
+  };
+
+  std::ofstream out(filename.c_str(), std::ios::out | std::ios::binary |
+                    std::ios::trunc);
+  if (not out.is_open())
+    throw meat::Exception(std::string("Unable to create heap snapshot ") +
+                          filename);
+
+  walker visit;
+
+  // The roots are the recorded classes and the active context.
+  for (auto entry = Class::begin(); entry != Class::end(); ++entry) {
+    std::uint32_t id = visit.add(&(*(entry->second)));
+    visit.flags[id] |= SNAPSHOT_CLASS_ROOT;
+  }
+  if (not context.is_null() and not (context == null)) {
+    std::uint32_t id = visit.add(&(*context));
+    visit.flags[id] |= SNAPSHOT_CONTEXT_ROOT;
+  }
+
+  /*  Trace the objects breadth first, the objects added while tracing are
+   * traced in turn. The references of each object are kept in order in
+   * edges, with where each object's references start in first.
+   */
+  std::vector<std::uint32_t> first;
+  for (std::size_t c = 0; c < visit.objects.size(); ++c) {
+    first.push_back(visit.edges.size());
+    visit.objects[c]->trace(visit);
+  }
+  first.push_back(visit.edges.size());
+
+  meat_header_t header = {{'M', 'H', 'S', 'P'}, 1, 0};
+  out.write((char *)&header, sizeof(meat_header_t));
+
+  std::uint32_t value = endian::write_be((std::uint32_t)
+                                         std::distance(Class::begin(),
+                                                       Class::end()));
+  out.write((char *)&value, 4);
+  for (auto entry = Class::begin(); entry != Class::end(); ++entry) {
+    value = endian::write_be(entry->first);
+    out.write((char *)&value, 4);
+    std::string name = cast<Class>(entry->second).name();
+    out.write(name.c_str(), name.size() + 1);
+  }
+
+  value = endian::write_be((std::uint32_t)visit.objects.size());
+  out.write((char *)&value, 4);
+  for (std::size_t c = 0; c < visit.objects.size(); ++c) {
+    Object *object = visit.objects[c];
+    std::uint8_t flags = visit.flags[c];
+
+    if (object->is_class()) {
+      flags |= SNAPSHOT_CLASS;
+      value = endian::write_be(static_cast<Class *>(object)->hash_id());
+    } else
+      value = endian::write_be(cast<Class>(object->type()).hash_id());
+    out.write((char *)&value, 4);
+
+    value = endian::write_be((std::uint32_t)memory::gc::block_size(object));
+    out.write((char *)&value, 4);
+    out.put(flags);
+
+    value = endian::write_be(first[c + 1] - first[c]);
+    out.write((char *)&value, 4);
+    for (std::uint32_t e = first[c]; e < first[c + 1]; ++e) {
+      value = endian::write_be(visit.edges[e]);
+      out.write((char *)&value, 4);
+    }
+  }
+
+  if (not out)
+    throw meat::Exception(std::string("Unable to write heap snapshot ") +
+                          filename);
+}
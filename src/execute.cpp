@@ -22,6 +22,7 @@
 #include <meat.h>
 #include <meat/utilities.h>
 #include <meat/bytecode.h>
+#include "meat-internal.h"
 
 #include <cstring>
 #include <sstream>
@@ -61,8 +62,8 @@ static std::string local(std::uint8_t id) {
 static std::string typenam(meat::Reference object) {
   if (object.is_null()) {
     return "Null";
-  } else if (object->is_object()) {
-    return meat::cast<meat::Class>(object->type()).name();
+  } else if (object.is_immediate() or object->is_object()) {
+    return meat::cast<meat::Class>(meat::type_of(object)).name();
   } else {
     return std::string("<") + meat::cast<meat::Class>(object).name() + ">";
   }
@@ -70,8 +71,95 @@ static std::string typenam(meat::Reference object) {
 
 #endif
 
+/*  The interpreter loop is written once and compiled either as a switch
+ * statement or, with --enable-threaded-dispatch, as a direct threaded
+ * interpreter using GNU computed gotos. In threaded mode every opcode handler
+ * jumps straight to the handler of the next opcode and only the opcodes that
+ * can finish a context fall through to the context unwinding code. Native
+ * code from the JIT is entered at the top of the loop, which every context
+ * change goes through, and at backward jumps so that long loops don't stay in
+ * the threaded dispatch once their method is compiled.
+ *
+ *  Note that a computed goto doesn't run the destructors of the scope it
+ * leaves, so every opcode handler closes its own scope before dispatching.
+ */
+#ifdef THREADED_DISPATCH
+#define OPCODE(name) op_##name
+#define OPCODE_DEFAULT op_unknown
+#define DISPATCH() \
+  do { \
+    in = &program[ip]; \
+    goto *dispatch_table[in->code]; \
+  } while (0)
+#define NEXT DISPATCH()
+#define NEXT_LOOP \
+  do { \
+    if (cls->_native and cls->_native[ip]) goto native; \
+    DISPATCH(); \
+  } while (0)
+#define NEXT_UNWIND goto unwind
+#define FALL_THROUGH
+#else
+#define OPCODE(name) case meat::bytecode::name
+#define OPCODE_DEFAULT default
+#define NEXT break
+#define NEXT_LOOP break
+#define NEXT_UNWIND break
+#define FALL_THROUGH [[gnu::fallthrough]]
+#endif
+
 using namespace meat;
 
+/** Local variable 2 of every context is the context itself. Copying it
+ * anywhere captures the context, so it needs to be promoted from the context
+ * frame stack.
+ */
+static inline void capture(Reference &context, std::uint8_t index) {
+  if (index == 2)
+    cast<Context>(cast<Context>(context).local(2)).promote();
+}
+
+/** Revert a quickened instruction to its generic form, which is then
+ * executed straight away. Only failed type guards count against the
+ * instruction, the cache epoch changes whenever a class is recorded.
+ */
+static inline void deoptimize(bytecode::instruction_t *in,
+                              bool guard_failed) {
+  in->code = in->generic;
+  if (guard_failed) in->deopts++;
+}
+
+/** The truth of a jump's condition, or -1 if the condition isn't a Boolean
+ * and the jump goes to its guard.
+ */
+static inline int truth(const Reference &condition) {
+  if (condition == Boolean(true)) return 1;
+  if (condition == Boolean(false)) return 0;
+  return -1;
+}
+
+/** Call the primitive of the context. If the primitive invoked a block then
+ * the block replaces it as the context and true is returned, the primitive
+ * is called again once the block is done. Otherwise the primitive is
+ * finished with its result.
+ * @see Context::invoke()
+ */
+static inline bool call(Reference &context) {
+  Context &ctx = cast<Context>(context);
+
+  ctx.local(2) = context.weak(); // context
+  Reference result = ctx(context);
+  if (not ctx.invoking()) {
+    ctx.result(std::move(result));
+    ctx.finish();
+    return false;
+  }
+
+  cast<Context>(result).messenger(context);
+  context = std::move(result);
+  return true;
+}
+
 /*****************
  * meat::execute *
  *****************/
@@ -80,86 +168,158 @@ meat::Reference meat::execute(Reference context) {
 
   if (context.is_null()) {
     throw Exception("Unable to execute a Null object");
-  } else  if (cast<Context>(context).flags == Context::PRIMATIVE) {
-    /* Here we execute a c++ native function.
+  } else  if (cast<Context>(context).flags == Context::PRIMATIVE and
+              not call(context)) {
+    /* Here we executed a c++ native function. If it invoked a block instead
+     * the block is run by the bytecode interpreter below, which returns once
+     * the native function is done.
      * XXX Catch C++ exceptions here.
      */
-
-    cast<Context>(context).local(2) = context.weak(); // context
-    Reference result = cast<Context>(context)(context);
-    cast<Context>(context).result(result);
-
-    return result;
+    return cast<Context>(context).result();
 
   } else {
-    /* The bytecode interpreter starts here */
+    /*  The bytecode interpreter starts here. It executes the predecoded
+     * instructions, so ip is an index into the instruction array rather than
+     * an offset into the bytecode.
+     */
     std::uint16_t ip = meat::cast<Context>(context)._ip;
-    const std::uint8_t *code =
-      cast<Class>(cast<Context>(context).klass()).bytecode();
+    Class *cls = &cast<Class>(cast<Context>(context).klass());
+    bytecode::instruction_t *program = cls->_program;
+    const std::uint32_t &epoch = InlineCache::current();
     cast<Context>(context).local(2) = context.weak();
 
 #ifdef DEBUG
     // Adds the class hash id and ip to debugging messages.
 #define BCLOC "(" << (cast<Class>(cast<Context>(context).klass()).name()) \
-                  << "," << itohex(ip, 4) << ")"
+                  << "," << itohex(program[ip].offset, 4) << ")"
     //std::cout << "Context " << (void *)&(*context) << std::endl;
 #endif
 
+#ifdef THREADED_DISPATCH
+    static void *dispatch_table[256];
+    static bool dispatch_ready = false;
+
+    if (not dispatch_ready) {
+      for (unsigned int c = 0; c < 256; c++)
+        dispatch_table[c] = &&OPCODE_DEFAULT;
+      dispatch_table[bytecode::NOOP] = &&OPCODE(NOOP);
+      dispatch_table[bytecode::MESSAGE] = &&OPCODE(MESSAGE);
+      dispatch_table[bytecode::MESG_SUPER] = &&OPCODE(MESG_SUPER);
+      dispatch_table[bytecode::MESG_RESULT] = &&OPCODE(MESG_RESULT);
+      dispatch_table[bytecode::MESG_SUPER_RESULT] =
+        &&OPCODE(MESG_SUPER_RESULT);
+      dispatch_table[bytecode::MESG_TAIL] = &&OPCODE(MESG_TAIL);
+      dispatch_table[bytecode::BLOCK_INLINE] = &&OPCODE(BLOCK_INLINE);
+      dispatch_table[bytecode::BLOCK] = &&OPCODE(BLOCK);
+      dispatch_table[bytecode::CONTEXT_END] = &&OPCODE(CONTEXT_END);
+      dispatch_table[bytecode::JUMP] = &&OPCODE(JUMP);
+      dispatch_table[bytecode::JUMP_IF_TRUE] = &&OPCODE(JUMP_IF_TRUE);
+      dispatch_table[bytecode::JUMP_IF_FALSE] = &&OPCODE(JUMP_IF_FALSE);
+      dispatch_table[bytecode::LOOP] = &&OPCODE(LOOP);
+      dispatch_table[bytecode::ASSIGN] = &&OPCODE(ASSIGN);
+      dispatch_table[bytecode::ASSIGN_PROP] = &&OPCODE(ASSIGN_PROP);
+      dispatch_table[bytecode::ASSIGN_CLASS_PROP] =
+        &&OPCODE(ASSIGN_CLASS_PROP);
+      dispatch_table[bytecode::ASSIGN_CLASS] = &&OPCODE(ASSIGN_CLASS);
+      dispatch_table[bytecode::ASSIGN_CONST_INT] = &&OPCODE(ASSIGN_CONST_INT);
+      dispatch_table[bytecode::ASSIGN_CONST_NUM] = &&OPCODE(ASSIGN_CONST_NUM);
+      dispatch_table[bytecode::ASSIGN_CONST_TXT] = &&OPCODE(ASSIGN_CONST_TXT);
+      dispatch_table[bytecode::ASSIGN_BLOCK_PARAM] =
+        &&OPCODE(ASSIGN_BLOCK_PARAM);
+      dispatch_table[bytecode::SET_PROP] = &&OPCODE(SET_PROP);
+      dispatch_table[bytecode::SET_CLASS_PROP] = &&OPCODE(SET_CLASS_PROP);
+      dispatch_table[bytecode::CALL_NATIVE] = &&OPCODE(CALL_NATIVE);
+      dispatch_table[bytecode::CALL_NATIVE_RESULT] =
+        &&OPCODE(CALL_NATIVE_RESULT);
+      dispatch_table[bytecode::LOAD_RESOLVED_CLASS] =
+        &&OPCODE(LOAD_RESOLVED_CLASS);
+      dispatch_table[bytecode::INT_ADD] = &&OPCODE(INT_ADD);
+      dispatch_table[bytecode::INT_SUB] = &&OPCODE(INT_SUB);
+      dispatch_ready = true;
+    }
+#endif
+
     while (not context.is_null()) {
 
+      /*  Exceptions are caught for the primitives running blocks with
+       * Context::invoke(), anything else is left to whoever called us.
+       */
+      try {
+
       /* Execute the byte code.
        */
-      bytecode::bytecode_t *bc = (bytecode::bytecode_t *)&code[ip];
-      switch (bc->code) {
+      bytecode::instruction_t *in = &program[ip];
 
-      case meat::bytecode::NOOP:
+      /*  If the JIT has compiled the code then run it natively instead. The
+       * native code returns whenever the context changes.
+       */
+      if (cls->_native and cls->_native[ip]) {
+#ifdef THREADED_DISPATCH
+      native:
+#endif
+        JIT::run(context, cls, cls->_native[ip]);
+        ip = cast<Context>(context)._ip;
+        cls = &cast<Class>(cast<Context>(context).klass());
+        program = cls->_program;
+        cast<Context>(context).local(2) = context.weak();
+        goto unwind;
+      }
+
+#ifdef THREADED_DISPATCH
+      goto *dispatch_table[in->code];
+      {
+#else
+      switch (in->code) {
+#endif
+
+      OPCODE(NOOP):
         // No Operations, possibly could be used for byte alignment.
-        ip++;
-        break;
+        ip = in->next;
+        NEXT;
 
-      case meat::bytecode::MESG_SUPER:
-      case meat::bytecode::MESSAGE: {
+      OPCODE(MESG_SUPER):
+      OPCODE(MESSAGE): {
         // Send a message to an object.
 
 #ifdef DEBUG
         Class &klass = cast<Class>(cast<Context>(context).klass());
         std::cout << "BC" << BCLOC;
-        switch (bc->code) {
+        switch (in->code) {
         case meat::bytecode::MESSAGE:
           std::cout << ": MESSAGE "; break;
         case meat::bytecode::MESG_SUPER:
           std::cout << ": MESSAGE SUPER "; break;
         default: break;
         }
-        std::cout << local(bc->o.m.object) << " "
-                  << klass.lookup(endian::read_be(bc->o.m.message_id)) << " ";
-        if (bc->o.m.parameters) {
-          for (uint8_t c = 0; c < bc->o.m.parameters; c++) {
-            std::cout << " " << local(bc->o.m.parameter[c]);
+        std::cout << local(in->source) << " "
+                  << klass.lookup(in->value) << " ";
+        if (in->count) {
+          for (uint8_t c = 0; c < in->count; c++) {
+            std::cout << " " << local(in->parameter[c]);
           }
         }
         std::cout << std::endl;
 #endif /* DEBUG */
 
-        Reference obj = cast<Context>(context).local(bc->o.m.object);
-        std::uint32_t method_id = endian::read_be(bc->o.m.message_id);
+        const Reference &obj = cast<Context>(context).local(in->source);
 
         // Create the new context in which to execute the message in.
         Reference new_ctx;
-        if (code[ip] == meat::bytecode::MESSAGE)
-          new_ctx = message(obj, method_id, context);
-        else
-          new_ctx = message_super(obj, method_id, context);
+        if (in->code == meat::bytecode::MESSAGE) {
+          new_ctx = message(obj, in->value, context, in->cache);
+          cls->quicken(ip, context);
+        } else
+          new_ctx = message_super(obj, in->value, context, in->cache);
 
         // Add the parameters to the new context.
-        for (uint8_t c = 0; c < bc->o.m.parameters; c++) {
-          Reference param =
-            cast<Context>(context).local(bc->o.m.parameter[c]);
-          cast<Context>(new_ctx).parameter(c, param);
+        for (uint8_t c = 0; c < in->count; c++) {
+          capture(context, in->parameter[c]);
+          cast<Context>(new_ctx).parameter(
+            c, cast<Context>(context).local(in->parameter[c]));
         }
 
         // Update the code pointer in the context.
-        ip += 7 + bc->o.m.parameters;
+        ip = in->next;
         cast<Context>(context)._ip = ip;
 
 #ifdef DEBUG
@@ -170,69 +330,89 @@ meat::Reference meat::execute(Reference context) {
         std::cout << std::endl;*/
 #endif
 
-        // Execute the message.
-        context = new_ctx;
-        if (cast<Context>(new_ctx).flags == Context::PRIMATIVE) {
-          cast<Context>(context).local(2) = new_ctx.weak();
-          cast<Context>(context).pointer(context);
-          cast<Context>(context).finish();
-        } else {
+        /*  Execute the message. A primitive is called straight away, unless
+         * it invokes a block which we then carry on with.
+         */
+        context = std::move(new_ctx);
+        if (cast<Context>(context).flags != Context::PRIMATIVE or
+            call(context)) {
           ip = cast<Context>(context)._ip;
-          code =
-            cast<Class>(cast<Context>(context).klass()).bytecode();
+          cls = &cast<Class>(cast<Context>(context).klass());
+          program = cls->_program;
           cast<Context>(context).local(2) = context.weak();
         }
 
-        break;
       }
+      NEXT_UNWIND;
+
+      OPCODE(MESG_TAIL):
+        /*  The method returns the result of this message, so the message's
+         * context can take our place. Otherwise it's sent like any other
+         * message with a result and the following return is run.
+         */
+        if (message_tail(context, in)) {
+#ifdef DEBUG
+          // The context is already replaced, so BCLOC can't be used.
+          std::cout << "BC(" << cls->name() << "," << itohex(in->offset, 4)
+                    << "): TAIL MESSAGE " << local(in->source) << " "
+                    << cls->lookup(in->value) << std::endl;
+#endif /* DEBUG */
+          ip = cast<Context>(context)._ip;
+          cls = &cast<Class>(cast<Context>(context).klass());
+          program = cls->_program;
+          cast<Context>(context).local(2) = context.weak();
+          NEXT_UNWIND;
+        }
+        FALL_THROUGH;
 
-      case meat::bytecode::MESG_SUPER_RESULT:
-      case meat::bytecode::MESG_RESULT: {
+      OPCODE(MESG_SUPER_RESULT):
+      OPCODE(MESG_RESULT): {
         // Send a message to an object with results.
 
 #ifdef DEBUG
         Class &klass = cast<Class>(cast<Context>(context).klass());
         std::cout << "BC" << BCLOC;
-        switch (bc->code) {
+        switch (in->code) {
         case meat::bytecode::MESG_RESULT:
+        case meat::bytecode::MESG_TAIL:
           std::cout << ": MESSAGE "; break;
         case meat::bytecode::MESG_SUPER:
           std::cout << ": MESSAGE SUPER "; break;
         default: break;
         }
-        std::cout << local(bc->o.mr.result) << " = ["
-                  << local(bc->o.mr.object) << " "
-                  << klass.lookup(endian::read_be(bc->o.mr.message_id));
-        if (bc->o.mr.parameters) {
-          for (uint8_t c = 0; c < bc->o.mr.parameters; c++) {
-            std::cout << " " << local(bc->o.mr.parameter[c]);
+        std::cout << local(in->destination) << " = ["
+                  << local(in->source) << " "
+                  << klass.lookup(in->value);
+        if (in->count) {
+          for (uint8_t c = 0; c < in->count; c++) {
+            std::cout << " " << local(in->parameter[c]);
           }
         }
         std::cout << "]" << std::endl;
 #endif /* DEBUG */
 
-        Reference obj = cast<Context>(context).local(bc->o.mr.object);
-        std::uint32_t method_id = endian::read_be(bc->o.mr.message_id);
+        const Reference &obj = cast<Context>(context).local(in->source);
 
         // Create the new context in which to execute the message in.
         Reference new_ctx;
-        if (code[ip] == meat::bytecode::MESG_RESULT)
-          new_ctx = message(obj, method_id, context);
-        else
-          new_ctx = message_super(obj, method_id, context);
+        if (in->code != meat::bytecode::MESG_SUPER_RESULT) {
+          new_ctx = message(obj, in->value, context, in->cache);
+          cls->quicken(ip, context);
+        } else
+          new_ctx = message_super(obj, in->value, context, in->cache);
 
         // Add the parameters to the new context.
-        for (uint8_t c = 0; c < bc->o.mr.parameters; c++) {
-          Reference param =
-            cast<Context>(context).local(bc->o.mr.parameter[c]);
-          cast<Context>(new_ctx).parameter(c, param);
+        for (uint8_t c = 0; c < in->count; c++) {
+          capture(context, in->parameter[c]);
+          cast<Context>(new_ctx).parameter(
+            c, cast<Context>(context).local(in->parameter[c]));
         }
 
         // Update the code pointer in the context.
-        ip += 8 + bc->o.mr.parameters;
+        ip = in->next;
         cast<Context>(context)._ip = ip;
 
-        cast<Context>(new_ctx).result_index(bc->o.mr.result);
+        cast<Context>(new_ctx).result_index(in->destination);
 
 #ifdef DEBUG
         /*std::cout << "Context " << (void *)&(*context) << " => "
@@ -242,210 +422,411 @@ meat::Reference meat::execute(Reference context) {
         std::cout << std::endl;*/
 #endif
 
-        // Execute the message.
-        context = new_ctx;
-        if (cast<Context>(new_ctx).flags == Context::PRIMATIVE) {
-          cast<Context>(context).local(2) = new_ctx.weak();
-          Reference result = cast<Context>(context).pointer(context);
-          cast<Context>(context).result(result);
-          cast<Context>(context).finish();
-        } else {
+        // Execute the message, the same as above.
+        context = std::move(new_ctx);
+        if (cast<Context>(context).flags != Context::PRIMATIVE or
+            call(context)) {
           ip = cast<Context>(context)._ip;
-          code = cast<Class>(cast<Context>(context).klass()).bytecode();
+          cls = &cast<Class>(cast<Context>(context).klass());
+          program = cls->_program;
           cast<Context>(context).local(2) = context.weak();
         }
 
-        break;
       }
+      NEXT_UNWIND;
 
-      case meat::bytecode::BLOCK: {
+      OPCODE(BLOCK): {
 #ifdef DEBUG
         std::cout << "BC" << BCLOC << ": BLOCK CONTEXT "
                   << std::dec
-                  << local(bc->o.bc.result) << " "
-                  << (unsigned int)bc->o.bc.locals << " "
-                  << (unsigned int)endian::read_be(bc->o.bc.code_size)
+                  << local(in->destination) << " "
+                  << (unsigned int)in->count << " "
+                  << (unsigned int)(program[in->next].offset -
+                                    in->offset - 5)
                   << std::endl;
 #endif /* DEBUG */
 
-        Reference block = new BlockContext(context, bc->o.bc.locals, ip + 5);
-        cast<Context>(context).local(bc->o.bc.result) = block;
+        // The block's code starts with the following instruction.
+        Reference block = new BlockContext(context, in->count, ip + 1);
+        cast<Context>(context).local(in->destination) = std::move(block);
 
-        ip += endian::read_be(bc->o.bc.code_size) + 5;
+        ip = in->next;
         cast<Context>(context)._ip = ip;
-        break;
       }
+      NEXT;
 
-      case meat::bytecode::CONTEXT_END:
+      OPCODE(CONTEXT_END):
 #ifdef DEBUG
         std::cout << "BC" << BCLOC << ": CONTEXT END"
                   << std::endl;
 #endif /* DEBUG */
         cast<Context>(context).finish();
-        break;
+        NEXT_UNWIND;
 
-      case meat::bytecode::ASSIGN: {
+      OPCODE(BLOCK_INLINE): {
+#ifdef DEBUG
+        std::cout << "BC" << BCLOC << ": BLOCK INLINE "
+                  << local(in->destination) << " "
+                  << itohex(program[in->target].offset, 4)
+                  << std::endl;
+#endif /* DEBUG */
+
+        /*  The block's code was compiled inline and its locals are kept in
+         * this context, so the block doesn't have any of its own.
+         */
+        Reference block = new BlockContext(context, 0, in->target);
+        cast<Context>(context).local(in->destination) = std::move(block);
+
+        ip = in->next;
+        cast<Context>(context)._ip = ip;
+      }
+      NEXT;
+
+      OPCODE(JUMP):
+#ifdef DEBUG
+        std::cout << "BC" << BCLOC << ": JUMP "
+                  << itohex(program[in->target].offset, 4)
+                  << std::endl;
+#endif /* DEBUG */
+
+        /*  The end of an inlined block finishes the block's context if the
+         * block is running as its own context rather than inline.
+         */
+        if (in->guard and
+            kind_of<BlockContext>::accepts(context->kind()) and
+            cast<BlockContext>(context).start() == in->guard) {
+          cast<Context>(context).finish();
+          NEXT_UNWIND;
+        }
+        if (in->target <= ip) {
+          ip = in->target;
+          NEXT_LOOP;
+        }
+        ip = in->target;
+        NEXT;
+
+      OPCODE(JUMP_IF_TRUE):
+      OPCODE(JUMP_IF_FALSE): {
+#ifdef DEBUG
+        std::cout << "BC" << BCLOC << ": JUMP IF "
+                  << (in->code == bytecode::JUMP_IF_TRUE ? "TRUE " : "FALSE ")
+                  << local(in->source) << " "
+                  << itohex(program[in->target].offset, 4) << " "
+                  << itohex(program[in->guard].offset, 4)
+                  << std::endl;
+#endif /* DEBUG */
+
+        int value = truth(cast<Context>(context).local(in->source));
+        if (value < 0)
+          ip = in->guard;
+        else if (value == (in->code == bytecode::JUMP_IF_TRUE))
+          ip = in->target;
+        else
+          ip = in->next;
+      }
+      NEXT;
+
+      OPCODE(LOOP): {
+#ifdef DEBUG
+        std::cout << "BC" << BCLOC << ": LOOP "
+                  << local(in->destination) << " < "
+                  << local(in->source) << " "
+                  << itohex(program[in->target].offset, 4) << " "
+                  << itohex(program[in->guard].offset, 4)
+                  << std::endl;
+#endif /* DEBUG */
+
+        const Reference &limit = cast<Context>(context).local(in->source);
+        Reference &count = cast<Context>(context).local(in->destination);
+        if (limit.is_null() or
+            not (type_of(limit) == Class::core(CORE_INTEGER))) {
+          ip = in->guard;
+        } else if (INTEGER(count) >= INTEGER(limit)) {
+          ip = in->target;
+        } else {
+          count = Integer(INTEGER(count) + 1);
+          ip = in->next;
+        }
+      }
+      NEXT;
+
+      OPCODE(ASSIGN): {
 #ifdef DEBUG
         std::cout << "BC" << BCLOC << ": ASSIGN " << std::dec
-                  << local(bc->o.a.destination) << " = "
-                  << local(bc->o.a.source)
+                  << local(in->destination) << " = "
+                  << local(in->source)
                   << std::endl;
 #endif /* DEBUG */
-        Reference src =
-          cast<Context>(context).local(bc->o.a.source);
-        cast<Context>(context).local(bc->o.a.destination) = src;
-        ip += 3;
-        break;
+        capture(context, in->source);
+        cast<Context>(context).local(in->destination) =
+          cast<Context>(context).local(in->source);
+        ip = in->next;
       }
+      NEXT;
 
-      case meat::bytecode::ASSIGN_PROP:
-      case meat::bytecode::ASSIGN_CLASS_PROP: {
+      OPCODE(ASSIGN_PROP):
+      OPCODE(ASSIGN_CLASS_PROP): {
         Reference self;
-        if (bc->code == bytecode::ASSIGN_PROP)
+        if (in->code == bytecode::ASSIGN_PROP)
           self = cast<Context>(context).self();
         else
           self = cast<Context>(context).klass();
 
 #ifdef DEBUG
         std::cout << "BC" << BCLOC;
-        switch (bc->code) {
+        switch (in->code) {
         case bytecode::ASSIGN_PROP:
           std::cout << ": GET PROPERTY "; break;
         case bytecode::ASSIGN_CLASS_PROP:
           std::cout << ": GET CLASS PROPERTY "; break;
         default: break;
         }
-        std::cout << local(bc->o.ap.destination) << " = "
-                  << (unsigned int)bc->o.ap.property_id
-                  << "(" << typenam(self->property(bc->o.ap.property_id)) << ")"
+        std::cout << local(in->destination) << " = "
+                  << (unsigned int)in->source
+                  << "(" << typenam(self->property(in->source)) << ")"
                   << std::endl;
 #endif /* DEBUG */
 
-        cast<Context>(context).local(bc->o.ap.destination) =
-          self->property(bc->o.ap.property_id);
-        ip += 3;
-        break;
+        cast<Context>(context).local(in->destination) =
+          self->property(in->source);
+        ip = in->next;
       }
+      NEXT;
 
-      case meat::bytecode::ASSIGN_CLASS: {
+      OPCODE(ASSIGN_CLASS): {
 #ifdef DEBUG
         Class &klass = cast<Class>(cast<Context>(context).klass());
         std::cout << "BC" << BCLOC << ": GET CLASS " << std::dec
-                  << local(bc->o.c.destination) << " = "
-                  << klass.lookup(endian::read_be(bc->o.c.class_id))
+                  << local(in->destination) << " = "
+                  << klass.lookup(in->value)
                   << std::endl;
 #endif /* DEBUG */
 
-        cast<Context>(context).local(bc->o.c.destination) =
-          Class::resolve(endian::read_be(bc->o.c.class_id));
-        ip += 6;
-        break;
+        cast<Context>(context).local(in->destination) =
+          Class::resolve(in->value);
+        cls->quicken(ip, context);
+        ip = in->next;
       }
+      NEXT;
 
-      case meat::bytecode::ASSIGN_CONST_INT: {
+      OPCODE(ASSIGN_CONST_INT): {
+        const Reference &int_obj = cls->constant(ip);
 #ifdef DEBUG
         std::cout << "BC" << BCLOC << ": INTEGER " << std::dec
-                  << local(bc->o.ci.destination) << " = "
-                  << (int)endian::read_be(bc->o.ci.value)
+                  << local(in->destination) << " = "
+                  << INTEGER(Reference(int_obj))
                   << std::endl;
 #endif /* DEBUG */
 
-        Reference intobj = new Value(endian::read_be(bc->o.ci.value));
-        cast<Context>(context).local(bc->o.ci.destination) = intobj;
-        ip += 6;
-        break;
+        cast<Context>(context).local(in->destination) = int_obj;
+        ip = in->next;
       }
+      NEXT;
 
-      case meat::bytecode::ASSIGN_CONST_NUM: {
+      OPCODE(ASSIGN_CONST_NUM): {
+        const Reference &float_obj = cls->constant(ip);
 #ifdef DEBUG
         std::cout << "BC" << BCLOC << ": NUMBER " << std::dec
-                  << local(bc->o.cn.destination) << " = ";
+                  << local(in->destination) << " = "
+                  << FLOAT(Reference(float_obj)) << std::endl;
 #endif /* DEBUG */
 
-        double mantissa = ldexp(endian::read_be(bc->o.cn.mantissa), -53);
-        Reference float_obj =
-          new Value(ldexp(mantissa, endian::read_be(bc->o.cn.exponent)));
-        cast<Context>(context).local(bc->o.cn.destination) = float_obj;
-#ifdef DEBUG
-        std::cout << FLOAT(float_obj) << std::endl;
-#endif /* DEBUG */
-        ip += 13;
-        break;
+        cast<Context>(context).local(in->destination) = float_obj;
+        ip = in->next;
       }
+      NEXT;
 
-      case meat::bytecode::ASSIGN_CONST_TXT: {
+      OPCODE(ASSIGN_CONST_TXT): {
+        /* Text literals are shared, none of the Text primitives modify the
+         * receiver so this is safe.
+         */
+        const Reference &strobj = cls->constant(ip);
 #ifdef DEBUG
         std::cout << "BC" << BCLOC << ": TEXT " << std::dec
-                  << local(bc->o.ct.destination) << " = "
-                  << "\"" << bc->o.ct.value << "\""
+                  << local(in->destination) << " = "
+                  << "\"" << cast<Text>(strobj) << "\""
                   << std::endl;
 #endif /* DEBUG */
 
-        Reference strobj = new Text((const char *)bc->o.ct.value);
-        cast<Context>(context).local(bc->o.ct.destination) = strobj;
-        ip += strlen((const char *)bc->o.ct.value) + 3;
-        break;
+        cast<Context>(context).local(in->destination) = strobj;
+        ip = in->next;
       }
+      NEXT;
 
-      case meat::bytecode::ASSIGN_BLOCK_PARAM: {
+      OPCODE(ASSIGN_BLOCK_PARAM): {
 #ifdef DEBUG
         std::cout << "BC" << BCLOC << ": BLOCK PARAMETER " << std::dec
-                  << local(bc->o.bp.destination) << " @ "
-                  << "\"" << local(bc->o.bp.local_index) << "\""
+                  << local(in->destination) << " @ "
+                  << "\"" << local(in->count) << "\""
                   << std::endl;
 #endif /* DEBUG */
 
         Reference block_parameter =
-          new BlockParameter(bc->o.bp.local_index,
-                             cast<Context>(context).local(bc->o.bp.block));
-        cast<Context>(context).local(bc->o.bp.destination) = block_parameter;
-        ip += 4;
-        break;
+          new BlockParameter(in->count,
+                             cast<Context>(context).local(in->source));
+        cast<Context>(context).local(in->destination) =
+          std::move(block_parameter);
+        ip = in->next;
       }
+      NEXT;
 
-      case meat::bytecode::SET_PROP:
-      case meat::bytecode::SET_CLASS_PROP: {
+      OPCODE(SET_PROP):
+      OPCODE(SET_CLASS_PROP): {
 #ifdef DEBUG
         std::cout << "BC" << BCLOC;
-        switch (bc->code) {
+        switch (in->code) {
         case bytecode::SET_PROP:
           std::cout << ": SET PROPERTY "; break;
         case bytecode::SET_CLASS_PROP:
           std::cout << ": SET CLASS PROPERTY "; break;
         default: break;
         }
-        std::cout << (unsigned int)bc->o.sp.destination << " = "
-                  << local(bc->o.sp.source) << std::endl;
+        std::cout << (unsigned int)in->destination << " = "
+                  << local(in->source) << std::endl;
 #endif /* DEBUG */
 
         Reference self;
-        if (bc->code == bytecode::SET_PROP) {
+        if (in->code == bytecode::SET_PROP) {
           self = cast<Context>(context).self();
-          if (not self->is_object())
+          if (self.is_immediate() or not self->is_object())
             throw Exception("Attempting to set an object property to a class.");
 
         } else
           self = cast<Context>(context).klass();
 
-        self->property(bc->o.sp.destination) =
-          cast<Context>(context).local(bc->o.sp.source);
-        ip += 3;
-        break;
+        capture(context, in->source);
+        self->property(in->destination) =
+          cast<Context>(context).local(in->source);
+        ip = in->next;
       }
+      NEXT;
 
-      default: {
+      OPCODE(CALL_NATIVE):
+      OPCODE(CALL_NATIVE_RESULT): {
+        /*  A send that resolved to a native method. As long as the receiver
+         * is the same class the method is called directly, skipping the
+         * method lookup and the switch to and from the new context.
+         */
+        const Reference &obj = cast<Context>(context).local(in->source);
+        bool valid = (in->epoch == epoch);
+        if (not valid or obj.is_null() or is_class(obj) or
+            not (type_of(obj) == cls->_constants[in->slot])) {
+          deoptimize(in, valid);
+        } else {
+#ifdef DEBUG
+          std::cout << "BC" << BCLOC << ": CALL NATIVE "
+                    << local(in->destination) << " = ["
+                    << local(in->source) << " "
+                    << cls->lookup(in->value) << "]" << std::endl;
+#endif /* DEBUG */
+
+          Context *ctx = new Context(context, in->method->locals, true);
+          Reference new_ctx(ctx);
+          ctx->_locals[0] = obj;                                // self
+          ctx->_locals[1] = cls->_constants[in->slot + 1].normal(); // class
+          ctx->_locals[2] = new_ctx.weak();                     // context
+          ctx->_locals[3] = meat::Null();                       // null
+          ctx->flags = Context::PRIMATIVE;
+          ctx->pointer = in->method->method.pointer;
+
+          for (uint8_t c = 0; c < in->count; c++) {
+            capture(context, in->parameter[c]);
+            ctx->parameter(c, cast<Context>(context).local(in->parameter[c]));
+          }
+
+          if (in->code == bytecode::CALL_NATIVE_RESULT)
+            ctx->result_index(in->destination);
+
+          ip = in->next;
+          cast<Context>(context)._ip = ip;
+
+          if (call(new_ctx)) {
+            // The native method invoked a block, which runs in its place.
+            context = std::move(new_ctx);
+            ip = cast<Context>(context)._ip;
+            cls = &cast<Class>(cast<Context>(context).klass());
+            program = cls->_program;
+            cast<Context>(context).local(2) = context.weak();
+          } else {
+            ctx->messenger(meat::Null());
+
+            /*  Blocks executed by the native method share our locals and
+             * replace the context local with themselves. This context may
+             * also have been resumed by another interpreter, so pick up where
+             * it left off.
+             */
+            cast<Context>(context).local(2) = context.weak();
+            ip = cast<Context>(context)._ip;
+          }
+        }
+      }
+      NEXT_UNWIND;
+
+      OPCODE(LOAD_RESOLVED_CLASS): {
+        // An ASSIGN_CLASS with the class already resolved.
+        if (in->epoch != epoch) {
+          cls->_constants[in->slot] = Class::resolve(in->value).weak();
+          in->epoch = epoch;
+        }
+
+#ifdef DEBUG
+        std::cout << "BC" << BCLOC << ": GET RESOLVED CLASS " << std::dec
+                  << local(in->destination) << " = "
+                  << cls->lookup(in->value) << std::endl;
+#endif /* DEBUG */
+
+        cast<Context>(context).local(in->destination) =
+          cls->_constants[in->slot].normal();
+        ip = in->next;
+      }
+      NEXT;
+
+      OPCODE(INT_ADD):
+      OPCODE(INT_SUB): {
+        // Integer + and - as long as both operands are still Integers.
+        Reference &self = cast<Context>(context).local(in->source);
+        Reference &other = cast<Context>(context).local(in->parameter[0]);
+        Reference &integer = cls->_constants[in->slot];
+        bool valid = (in->epoch == epoch);
+        if (not valid or self.is_null() or other.is_null() or
+            not (type_of(self) == integer) or not (type_of(other) == integer)) {
+          deoptimize(in, valid);
+        } else {
+#ifdef DEBUG
+          std::cout << "BC" << BCLOC << ": INTEGER "
+                    << (in->code == bytecode::INT_ADD ? "ADD " : "SUB ")
+                    << local(in->destination) << " = "
+                    << local(in->source) << ", "
+                    << local(in->parameter[0]) << std::endl;
+#endif /* DEBUG */
+
+          std::int32_t value = INTEGER(self);
+          if (in->code == bytecode::INT_ADD) value += INTEGER(other);
+          else value -= INTEGER(other);
+          cast<Context>(context).local(in->destination) = Integer(value);
+          ip = in->next;
+        }
+      }
+      NEXT;
+
+      OPCODE_DEFAULT: {
         std::stringstream errmsg;
         errmsg << "Unknown bytecode " << std::showbase << std::hex
-               << (unsigned int)code[ip] << " @ " << (unsigned int)ip
+               << (unsigned int)in->code << " @ " << (unsigned int)in->offset
                << " in class "
                << cast<Class>(cast<Context>(context).klass()).name();
         throw Exception(errmsg.str());
       }
       }
 
+      } catch (...) {
+        if (not catch_exception(context)) throw;
+      }
+
       /*  Now we need to check if the current context is done and if it is
        * look for the next upper level not done context.
        */
+    unwind:
       while (cast<Context>(context).is_done()) {
         /*  Get the result and the messaging context to the current context.
          * We also clean up the reference to the messaging context in the old
@@ -458,9 +839,9 @@ meat::Reference meat::execute(Reference context) {
           meat::test::failed("Context weak self reference", false);
         }
 #endif
-        Reference old_ctx = context;
-        context = cast<Context>(context).messenger();
-        cast<Context>(old_ctx).messenger(meat::Null());
+        Reference old_ctx = std::move(context);
+        context = std::move(cast<Context>(old_ctx)._messenger);
+        cast<Context>(old_ctx)._messenger = meat::Null();
         //cast<Context>(old_ctx).local(2) = NULL; // context
 
 #ifdef DEBUG
@@ -474,22 +855,80 @@ meat::Reference meat::execute(Reference context) {
         }
 
         /*  If we were called by a primative method then we need to return back
-         * to it.
+         * to it. A primitive waiting on the block it invoked is called again
+         * instead, it looks after the block itself.
          */
         if (cast<Context>(context).flags == Context::PRIMATIVE) {
-          return cast<Context>(old_ctx).result();
-        }
-
-        cast<Context>(old_ctx).reset();
+          if (not cast<Context>(context).invoking())
+            return cast<Context>(old_ctx).result();
+          try {
+            call(context);
+          } catch (...) {
+            if (not catch_exception(context)) throw;
+          }
+        } else
+          cast<Context>(old_ctx).reset();
 
         if (not cast<Context>(context).is_done()) {
           ip = cast<Context>(context)._ip;
-          code = cast<Class>(cast<Context>(context).klass()).bytecode();
+          cls = &cast<Class>(cast<Context>(context).klass());
+          program = cls->_program;
           cast<Context>(context).local(2) = context.weak(); // context
         }
+
+        // Returning from a message is a safe point to collect garbage.
+        if (memory::gc::collection_due()) memory::gc::collect();
       }
     }
   }
 
   return meat::Null();
 }
+
+/*************************
+ * meat::catch_exception *
+ *************************/
+
+bool meat::catch_exception(Reference &context) {
+  Reference error;
+  try {
+    throw;
+  } catch (meat::Exception &err) {
+    error = new meat::Exception(err);
+  } catch (std::exception &err) {
+    error = new meat::Exception(std::string(err.what()));
+  } catch (...) {
+    return false;
+  }
+
+  /*  The context itself is skipped, if it's a primitive then it raised the
+   * exception so it can't be waiting on a block.
+   */
+  Reference ctx = context;
+  for (;;) {
+    const Reference &next = cast<Context>(ctx)._messenger;
+    if (next.is_null() or next == meat::Null()) return false;
+
+    Context &messenger = cast<Context>(next);
+    if (messenger.flags == Context::PRIMATIVE) {
+      if (not messenger.invoking()) return false;
+      if (messenger._invoke & Context::INVOKE_CATCHES) {
+        messenger._result = std::move(error);
+        messenger._invoke |= Context::INVOKE_CAUGHT;
+        break;
+      }
+    }
+    ctx = next;
+  }
+
+  /*  The contexts between are abandoned, they let go of their messengers
+   * just like they do when they're unwound.
+   */
+  cast<Context>(ctx).finish();
+  while (not (context == ctx)) {
+    Reference old_ctx = std::move(context);
+    context = std::move(cast<Context>(old_ctx)._messenger);
+    cast<Context>(old_ctx)._messenger = meat::Null();
+  }
+  return true;
+}
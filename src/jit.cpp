@@ -0,0 +1,818 @@
+/*                                                                  -*- c++ -*-
+ * The Template JIT
+ *
+ * Copyright (c) 2017 Ron R Wills <ron.rwsoft@gmail.com>
+ *
+ * This file is part of Meat.
+ *
+ * Meat is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Meat is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Meat.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <meat.h>
+#include <meat/utilities.h>
+#include <meat/bytecode.h>
+#include "meat-internal.h"
+
+#include <cstring>
+#include <vector>
+
+/*  The native code follows the System V calling convention, so the JIT is
+ * only built for x86-64 on the unix like platforms.
+ */
+#if defined(__x86_64__) && !defined(_WIN32)
+#define JIT_X86_64
+#include <sys/mman.h>
+#endif
+
+using namespace meat;
+
+/** What the helpers return to the native code.
+ */
+#define JIT_CONTINUE 0 // Carry on with the next instruction.
+#define JIT_LEAVE    1 // Return to the interpreter.
+#define JIT_ERROR    2 // The helper raised an exception.
+#define JIT_JUMP     3 // Carry on from the instruction's jump target.
+
+/*  Exceptions can't be unwound through the native code, so the helpers catch
+ * them and JIT::run() raises them again once the native code has returned.
+ */
+#define JIT_TRY try {
+#define JIT_CATCH \
+  } catch (...) { \
+    frame->error = std::current_exception(); \
+    return JIT_ERROR; \
+  }
+
+static bool &jit_enabled() {
+  static bool enabled = false;
+
+  return enabled;
+}
+
+/** Copying the context local captures the context, the same as in the
+ * interpreter.
+ */
+static inline void capture(Reference &context, std::uint8_t index) {
+  if (index == 2)
+    cast<Context>(cast<Context>(context).local(2)).promote();
+}
+
+/** The truth of a jump's condition, or -1 if the condition isn't a Boolean,
+ * the same as in the interpreter.
+ */
+static inline int truth(const Reference &condition) {
+  if (condition == Boolean(true)) return 1;
+  if (condition == Boolean(false)) return 0;
+  return -1;
+}
+
+/** Revert a quickened instruction to its generic form, the same as the
+ * interpreter does.
+ */
+static inline void deoptimize(bytecode::instruction_t *in,
+                              bool guard_failed) {
+  in->code = in->generic;
+  if (guard_failed) in->deopts++;
+}
+
+/******************************************************************************
+ * Native Code Memory
+ *
+ *  The native code is written into chunks of memory that are never freed,
+ * just like the methods they were compiled from. A chunk is only writable
+ * while the JIT is writing code into it.
+ */
+
+#ifdef JIT_X86_64
+
+#define CODE_CHUNK_SIZE (256 * 1024)
+
+typedef struct _code_chunk_s {
+  std::uint8_t *base;
+  std::size_t used;
+} code_chunk_t;
+
+static code_chunk_t &code_chunk() {
+  static code_chunk_t chunk = {nullptr, 0};
+
+  return chunk;
+}
+
+/**************
+ * code_alloc *
+ **************/
+
+static std::uint8_t *code_alloc(std::size_t size) {
+  code_chunk_t &chunk = code_chunk();
+
+  if (size > CODE_CHUNK_SIZE) return nullptr;
+  if (chunk.base == nullptr or chunk.used + size > CODE_CHUNK_SIZE) {
+    void *base = mmap(nullptr, CODE_CHUNK_SIZE, PROT_READ | PROT_EXEC,
+                      MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (base == MAP_FAILED) return nullptr;
+    chunk.base = (std::uint8_t *)base;
+    chunk.used = 0;
+  }
+
+  std::uint8_t *code = chunk.base + chunk.used;
+  chunk.used += size;
+  return code;
+}
+
+/*****************
+ * code_writable *
+ *****************/
+
+static void code_writable(bool writable) {
+  code_chunk_t &chunk = code_chunk();
+  mprotect(chunk.base, CODE_CHUNK_SIZE,
+           PROT_READ | (writable ? PROT_WRITE : PROT_EXEC));
+}
+
+/******************************************************************************
+ * x86-64 Templates
+ *
+ *  The native code keeps the JIT frame in rbx. Every instruction's template
+ * loads the frame and the instruction as the arguments for its helper, calls
+ * it and leaves for the interpreter if the helper didn't return
+ * JIT_CONTINUE. The jumps also branch to their target's template when the
+ * helper returns JIT_JUMP.
+ */
+
+#define CALL_SIZE   25 // mov rdi, rbx; mov rsi, in; mov rax, helper; call rax
+#define LEAVE_SIZE   8 // test eax, eax; jnz exit
+#define BRANCH_SIZE  9 // cmp eax, JIT_JUMP; je target
+#define JUMP_SIZE    5 // jmp target
+#define EXIT_SIZE    6 // mov rbx, [rbp - 8]; leave; ret
+#define ENTER_SIZE  14
+
+static inline void emit(std::uint8_t *&pc, std::uint8_t byte) {
+  *pc++ = byte;
+}
+
+static inline void emit64(std::uint8_t *&pc, const void *value) {
+  std::memcpy(pc, &value, 8);
+  pc += 8;
+}
+
+static inline void emit_rel32(std::uint8_t *&pc, const std::uint8_t *target) {
+  std::int32_t rel = (std::int32_t)(target - (pc + 4));
+  std::memcpy(pc, &rel, 4);
+  pc += 4;
+}
+
+static void emit_call(std::uint8_t *&pc, JIT::helper_t helper,
+                      bytecode::instruction_t *in) {
+  emit(pc, 0x48); emit(pc, 0x89); emit(pc, 0xdf);  // mov rdi, rbx
+  emit(pc, 0x48); emit(pc, 0xbe); emit64(pc, in);  // mov rsi, in
+  emit(pc, 0x48); emit(pc, 0xb8);                  // mov rax, helper
+  emit64(pc, (const void *)helper);
+  emit(pc, 0xff); emit(pc, 0xd0);                  // call rax
+}
+
+static void emit_leave(std::uint8_t *&pc, const std::uint8_t *exit) {
+  emit(pc, 0x85); emit(pc, 0xc0);                  // test eax, eax
+  emit(pc, 0x0f); emit(pc, 0x85);                  // jnz exit
+  emit_rel32(pc, exit);
+}
+
+static void emit_branch(std::uint8_t *&pc, const std::uint8_t *target) {
+  emit(pc, 0x83); emit(pc, 0xf8);                  // cmp eax, JIT_JUMP
+  emit(pc, JIT_JUMP);
+  emit(pc, 0x0f); emit(pc, 0x84);                  // je target
+  emit_rel32(pc, target);
+}
+
+static void emit_jump(std::uint8_t *&pc, const std::uint8_t *target) {
+  emit(pc, 0xe9);                                  // jmp target
+  emit_rel32(pc, target);
+}
+
+static void emit_exit(std::uint8_t *&pc) {
+  emit(pc, 0x48); emit(pc, 0x8b);                  // mov rbx, [rbp - 8]
+  emit(pc, 0x5d); emit(pc, 0xf8);
+  emit(pc, 0xc9);                                  // leave
+  emit(pc, 0xc3);                                  // ret
+}
+
+/** The entry into the native code, called as
+ * int enter(JIT::frame_t *frame, void *code). It saves rbx, keeping the
+ * stack aligned for the helper calls, and jumps to the code.
+ */
+static std::uint8_t *enter_stub() {
+  static std::uint8_t *stub = nullptr;
+
+  if (stub == nullptr) {
+    std::uint8_t *code = code_alloc(ENTER_SIZE);
+    if (code == nullptr) return nullptr;
+
+    std::uint8_t *pc = code;
+    code_writable(true);
+    emit(pc, 0x55);                                // push rbp
+    emit(pc, 0x48); emit(pc, 0x89); emit(pc, 0xe5);  // mov rbp, rsp
+    emit(pc, 0x53);                                // push rbx
+    emit(pc, 0x48); emit(pc, 0x83);                // sub rsp, 8
+    emit(pc, 0xec); emit(pc, 0x08);
+    emit(pc, 0x48); emit(pc, 0x89); emit(pc, 0xfb);  // mov rbx, rdi
+    emit(pc, 0xff); emit(pc, 0xe6);                // jmp rsi
+    code_writable(false);
+    stub = code;
+  }
+  return stub;
+}
+
+#endif /* JIT_X86_64 */
+
+/******************************************************************************
+ * meat::JIT Class
+ */
+
+std::uint32_t meat::JIT::threshold = JIT_THRESHOLD;
+
+/**********************
+ * meat::JIT::enabled *
+ **********************/
+
+bool meat::JIT::enabled() {
+  return jit_enabled();
+}
+
+/*********************
+ * meat::JIT::enable *
+ *********************/
+
+bool meat::JIT::enable(bool enable) {
+#ifdef JIT_X86_64
+  jit_enabled() = enable;
+  return true;
+#else
+  (void)enable;
+  return false;
+#endif
+}
+
+/**********************
+ * meat::JIT::compile *
+ **********************/
+
+void meat::JIT::compile(Class &cls, std::uint16_t entry) {
+#ifdef JIT_X86_64
+  if (not jit_enabled()) return;
+  if (cls._native and cls._native[entry]) return;
+
+  bytecode::instruction_t *program = cls._program;
+  std::uint16_t count = cls._entry_index[cls._bytecode_size] + 1;
+
+  /*  Find the end of the method by following the instructions, BLOCK skips
+   * over the code for the block. The blocks are compiled along with the
+   * method.
+   */
+  std::uint16_t end = entry;
+  while (program[end].code != bytecode::CONTEXT_END) {
+    end = program[end].next;
+    if (end >= count) return;
+  }
+
+  // Work out where each instruction's template starts.
+  std::vector<std::size_t> offsets(end - entry + 1);
+  std::size_t size = 0;
+  for (std::uint16_t index = entry; index <= end; index++) {
+    bytecode::instruction_t &in = program[index];
+    offsets[index - entry] = size;
+
+    switch (in.code) {
+    case bytecode::NOOP:
+      break;
+    case bytecode::CONTEXT_END:
+      size += CALL_SIZE + JUMP_SIZE;
+      break;
+    case bytecode::BLOCK:
+      if (in.next <= index or in.next > end) return;
+      size += CALL_SIZE + LEAVE_SIZE + JUMP_SIZE;
+      break;
+    case bytecode::JUMP:
+    case bytecode::JUMP_IF_TRUE:
+    case bytecode::JUMP_IF_FALSE:
+    case bytecode::LOOP:
+      // The guards are left to the interpreter, only the target is native.
+      if (in.target < entry or in.target > end) return;
+      size += CALL_SIZE + BRANCH_SIZE + LEAVE_SIZE;
+      break;
+    default:
+      // Leave anything we don't know about to the interpreter.
+      if (helper(in.code) == nullptr) return;
+      size += CALL_SIZE + LEAVE_SIZE;
+      break;
+    }
+  }
+
+  std::uint8_t *enter = enter_stub();
+  std::uint8_t *code = code_alloc(size + EXIT_SIZE);
+  if (enter == nullptr or code == nullptr) return;
+  std::uint8_t *exit = code + size;
+
+  code_writable(true);
+  std::uint8_t *pc = code;
+  for (std::uint16_t index = entry; index <= end; index++) {
+    bytecode::instruction_t *in = &program[index];
+
+    switch (in->code) {
+    case bytecode::NOOP:
+      break;
+    case bytecode::CONTEXT_END:
+      emit_call(pc, context_end, in);
+      emit_jump(pc, exit);
+      break;
+    case bytecode::BLOCK:
+      emit_call(pc, block, in);
+      emit_leave(pc, exit);
+      emit_jump(pc, code + offsets[in->next - entry]);
+      break;
+    case bytecode::JUMP:
+    case bytecode::JUMP_IF_TRUE:
+    case bytecode::JUMP_IF_FALSE:
+    case bytecode::LOOP:
+      emit_call(pc, helper(in->code), in);
+      emit_branch(pc, code + offsets[in->target - entry]);
+      emit_leave(pc, exit);
+      break;
+    default:
+      emit_call(pc, helper(in->code), in);
+      emit_leave(pc, exit);
+      break;
+    }
+  }
+  emit_exit(pc);
+  code_writable(false);
+
+  if (cls._native == nullptr) {
+    cls._native = new void *[count];
+    std::memset(cls._native, 0, sizeof(void *) * count);
+  }
+  for (std::uint16_t index = entry; index <= end; index++)
+    cls._native[index] = code + offsets[index - entry];
+#else
+  (void)cls;
+  (void)entry;
+#endif
+}
+
+/******************
+ * meat::JIT::run *
+ ******************/
+
+void meat::JIT::run(Reference &context, Class *cls, void *code) {
+#ifdef JIT_X86_64
+  typedef int (*enter_t)(frame_t *frame, void *code);
+
+  frame_t frame = {&context, cls, nullptr};
+  enter_t enter = (enter_t)enter_stub();
+
+  if (enter(&frame, code) == JIT_ERROR)
+    std::rethrow_exception(frame.error);
+#else
+  (void)context;
+  (void)cls;
+  (void)code;
+#endif
+}
+
+/*********************
+ * meat::JIT::helper *
+ *********************/
+
+meat::JIT::helper_t meat::JIT::helper(std::uint8_t code) {
+  switch (code) {
+  case bytecode::MESSAGE:
+  case bytecode::MESG_RESULT:
+  case bytecode::MESG_SUPER:
+  case bytecode::MESG_SUPER_RESULT:
+  case bytecode::MESG_TAIL:
+  case bytecode::CALL_NATIVE:
+  case bytecode::CALL_NATIVE_RESULT:
+  case bytecode::INT_ADD:
+  case bytecode::INT_SUB:
+    return send;
+  case bytecode::BLOCK:
+    return block;
+  case bytecode::BLOCK_INLINE:
+    return block_inline;
+  case bytecode::JUMP:
+    return jump;
+  case bytecode::JUMP_IF_TRUE:
+  case bytecode::JUMP_IF_FALSE:
+    return jump_if;
+  case bytecode::LOOP:
+    return loop;
+  case bytecode::CONTEXT_END:
+    return context_end;
+  case bytecode::ASSIGN:
+    return assign;
+  case bytecode::ASSIGN_PROP:
+  case bytecode::ASSIGN_CLASS_PROP:
+    return get_property;
+  case bytecode::ASSIGN_CLASS:
+  case bytecode::LOAD_RESOLVED_CLASS:
+    return load_class;
+  case bytecode::ASSIGN_CONST_INT:
+  case bytecode::ASSIGN_CONST_NUM:
+  case bytecode::ASSIGN_CONST_TXT:
+    return constant;
+  case bytecode::ASSIGN_BLOCK_PARAM:
+    return block_param;
+  case bytecode::SET_PROP:
+  case bytecode::SET_CLASS_PROP:
+    return set_property;
+  default:
+    return nullptr;
+  }
+}
+
+/*******************
+ * meat::JIT::send *
+ *******************/
+
+int meat::JIT::send(frame_t *frame, bytecode::instruction_t *in) {
+  /*  The interpreter quickens the send sites the same as it does for the
+   * bytecode it runs, so the quickened form is picked up here even if the
+   * send was quickened after the method was compiled.
+   */
+  switch (in->code) {
+  case bytecode::CALL_NATIVE:
+  case bytecode::CALL_NATIVE_RESULT:
+    return call_native(frame, in);
+  case bytecode::INT_ADD:
+  case bytecode::INT_SUB:
+    return arithmetic(frame, in);
+  default:
+    return message(frame, in);
+  }
+}
+
+/**********************
+ * meat::JIT::message *
+ **********************/
+
+int meat::JIT::message(frame_t *frame, bytecode::instruction_t *in) {
+  JIT_TRY
+    Reference &context = *frame->context;
+    Class &cls = *frame->cls;
+    std::uint8_t code = in->code;
+
+    // The interpreter carries on with the context that replaced ours.
+    if (code == bytecode::MESG_TAIL and message_tail(context, in))
+      return JIT_LEAVE;
+
+    const Reference &obj = cast<Context>(context).local(in->source);
+
+    // Create the new context in which to execute the message in.
+    Reference new_ctx;
+    if (code != bytecode::MESG_SUPER and code != bytecode::MESG_SUPER_RESULT) {
+      new_ctx = meat::message(obj, in->value, context, in->cache);
+      cls.quicken(in - cls._program, context);
+    } else
+      new_ctx = message_super(obj, in->value, context, in->cache);
+
+    for (std::uint8_t c = 0; c < in->count; c++) {
+      capture(context, in->parameter[c]);
+      cast<Context>(new_ctx).parameter(
+        c, cast<Context>(context).local(in->parameter[c]));
+    }
+
+    cast<Context>(context)._ip = in->next;
+    if (code != bytecode::MESSAGE and code != bytecode::MESG_SUPER)
+      cast<Context>(new_ctx).result_index(in->destination);
+
+    if (cast<Context>(new_ctx).flags == Context::PRIMATIVE)
+      return primitive(frame, in, new_ctx);
+
+    // The interpreter switches to the bytecode method's context.
+    context = std::move(new_ctx);
+    return JIT_LEAVE;
+  JIT_CATCH
+}
+
+/************************
+ * meat::JIT::primitive *
+ ************************/
+
+int meat::JIT::primitive(frame_t *frame, bytecode::instruction_t *in,
+                         Reference &new_ctx) {
+  Reference &context = *frame->context;
+  Context &callee = cast<Context>(new_ctx);
+
+  callee.local(2) = new_ctx.weak();
+  Reference result = callee(new_ctx);
+  if (callee.invoking()) {
+    // The interpreter runs the block the native method invoked in its place.
+    cast<Context>(result).messenger(new_ctx);
+    context = std::move(result);
+    return JIT_LEAVE;
+  }
+  callee.result(std::move(result));
+  callee.messenger(meat::Null());
+
+  /*  Blocks executed by the native method share our locals and replace the
+   * context local with themselves. The context may also have been finished
+   * or resumed somewhere else, which the interpreter has to sort out.
+   */
+  Context &ctx = cast<Context>(context);
+  ctx.local(2) = context.weak();
+  if (ctx.is_done() or ctx._ip != in->next) return JIT_LEAVE;
+  return JIT_CONTINUE;
+}
+
+/**************************
+ * meat::JIT::call_native *
+ **************************/
+
+int meat::JIT::call_native(frame_t *frame, bytecode::instruction_t *in) {
+  JIT_TRY
+    Reference &context = *frame->context;
+    Class &cls = *frame->cls;
+    const Reference &obj = cast<Context>(context).local(in->source);
+
+    // The same guard as the interpreter's.
+    bool valid = (in->epoch == InlineCache::current());
+    if (not valid or obj.is_null() or is_class(obj) or
+        not (type_of(obj) == cls._constants[in->slot])) {
+      deoptimize(in, valid);
+      return message(frame, in);
+    }
+
+    Context *ctx = new Context(context, in->method->locals, true);
+    Reference new_ctx(ctx);
+    ctx->_locals[0] = obj;                                  // self
+    ctx->_locals[1] = cls._constants[in->slot + 1].normal(); // class
+    ctx->_locals[3] = meat::Null();                         // null
+    ctx->flags = Context::PRIMATIVE;
+    ctx->pointer = in->method->method.pointer;
+
+    for (std::uint8_t c = 0; c < in->count; c++) {
+      capture(context, in->parameter[c]);
+      ctx->parameter(c, cast<Context>(context).local(in->parameter[c]));
+    }
+
+    cast<Context>(context)._ip = in->next;
+    if (in->code == bytecode::CALL_NATIVE_RESULT)
+      ctx->result_index(in->destination);
+
+    return primitive(frame, in, new_ctx);
+  JIT_CATCH
+}
+
+/*************************
+ * meat::JIT::arithmetic *
+ *************************/
+
+int meat::JIT::arithmetic(frame_t *frame, bytecode::instruction_t *in) {
+  JIT_TRY
+    Context &ctx = cast<Context>(*frame->context);
+    Reference &self = ctx.local(in->source);
+    Reference &other = ctx.local(in->parameter[0]);
+    Reference &integer = frame->cls->_constants[in->slot];
+
+    bool valid = (in->epoch == InlineCache::current());
+    if (not valid or self.is_null() or other.is_null() or
+        not (type_of(self) == integer) or not (type_of(other) == integer)) {
+      deoptimize(in, valid);
+      return message(frame, in);
+    }
+
+    std::int32_t value = INTEGER(self);
+    if (in->code == bytecode::INT_ADD) value += INTEGER(other);
+    else value -= INTEGER(other);
+    ctx.local(in->destination) = Integer(value);
+    return JIT_CONTINUE;
+  JIT_CATCH
+}
+
+/********************
+ * meat::JIT::block *
+ ********************/
+
+int meat::JIT::block(frame_t *frame, bytecode::instruction_t *in) {
+  JIT_TRY
+    Reference &context = *frame->context;
+    std::uint16_t index = in - frame->cls->_program;
+
+    Reference block = new BlockContext(context, in->count, index + 1);
+    cast<Context>(context).local(in->destination) = std::move(block);
+    cast<Context>(context)._ip = in->next;
+    return JIT_CONTINUE;
+  JIT_CATCH
+}
+
+/***************************
+ * meat::JIT::block_inline *
+ ***************************/
+
+int meat::JIT::block_inline(frame_t *frame, bytecode::instruction_t *in) {
+  JIT_TRY
+    Reference &context = *frame->context;
+
+    Reference block = new BlockContext(context, 0, in->target);
+    cast<Context>(context).local(in->destination) = std::move(block);
+    cast<Context>(context)._ip = in->next;
+    return JIT_CONTINUE;
+  JIT_CATCH
+}
+
+/*******************
+ * meat::JIT::jump *
+ *******************/
+
+int meat::JIT::jump(frame_t *frame, bytecode::instruction_t *in) {
+  Reference &context = *frame->context;
+
+  // The end of an inlined block running as its own context.
+  if (in->guard and kind_of<BlockContext>::accepts(context->kind()) and
+      cast<BlockContext>(context).start() == in->guard) {
+    cast<Context>(context).finish();
+    return JIT_LEAVE;
+  }
+  return JIT_JUMP;
+}
+
+/**********************
+ * meat::JIT::jump_if *
+ **********************/
+
+int meat::JIT::jump_if(frame_t *frame, bytecode::instruction_t *in) {
+  Context &ctx = cast<Context>(*frame->context);
+
+  int value = truth(ctx.local(in->source));
+  if (value < 0) {
+    // The interpreter carries on from the guard.
+    ctx._ip = in->guard;
+    return JIT_LEAVE;
+  }
+  if (value == (in->code == bytecode::JUMP_IF_TRUE)) return JIT_JUMP;
+  return JIT_CONTINUE;
+}
+
+/*******************
+ * meat::JIT::loop *
+ *******************/
+
+int meat::JIT::loop(frame_t *frame, bytecode::instruction_t *in) {
+  JIT_TRY
+    Context &ctx = cast<Context>(*frame->context);
+    const Reference &limit = ctx.local(in->source);
+    Reference &count = ctx.local(in->destination);
+
+    if (limit.is_null() or
+        not (type_of(limit) == Class::core(CORE_INTEGER))) {
+      ctx._ip = in->guard;
+      return JIT_LEAVE;
+    }
+    if (INTEGER(count) >= INTEGER(limit)) return JIT_JUMP;
+    count = Integer(INTEGER(count) + 1);
+    return JIT_CONTINUE;
+  JIT_CATCH
+}
+
+/**************************
+ * meat::JIT::context_end *
+ **************************/
+
+int meat::JIT::context_end(frame_t *frame, bytecode::instruction_t *in) {
+  (void)in;
+  cast<Context>(*frame->context).finish();
+  return JIT_LEAVE;
+}
+
+/*********************
+ * meat::JIT::assign *
+ *********************/
+
+int meat::JIT::assign(frame_t *frame, bytecode::instruction_t *in) {
+  JIT_TRY
+    Reference &context = *frame->context;
+
+    capture(context, in->source);
+    cast<Context>(context).local(in->destination) =
+      cast<Context>(context).local(in->source);
+    return JIT_CONTINUE;
+  JIT_CATCH
+}
+
+/***************************
+ * meat::JIT::get_property *
+ ***************************/
+
+int meat::JIT::get_property(frame_t *frame, bytecode::instruction_t *in) {
+  JIT_TRY
+    Context &ctx = cast<Context>(*frame->context);
+    Reference self;
+    if (in->code == bytecode::ASSIGN_PROP)
+      self = ctx.self();
+    else
+      self = ctx.klass();
+
+    ctx.local(in->destination) = self->property(in->source);
+    return JIT_CONTINUE;
+  JIT_CATCH
+}
+
+/*************************
+ * meat::JIT::load_class *
+ *************************/
+
+int meat::JIT::load_class(frame_t *frame, bytecode::instruction_t *in) {
+  JIT_TRY
+    Reference &context = *frame->context;
+    Class &cls = *frame->cls;
+
+    if (in->code == bytecode::ASSIGN_CLASS) {
+      cast<Context>(context).local(in->destination) =
+        Class::resolve(in->value);
+      cls.quicken(in - cls._program, context);
+    } else {
+      if (in->epoch != InlineCache::current()) {
+        cls._constants[in->slot] = Class::resolve(in->value).weak();
+        in->epoch = InlineCache::current();
+      }
+      cast<Context>(context).local(in->destination) =
+        cls._constants[in->slot].normal();
+    }
+    return JIT_CONTINUE;
+  JIT_CATCH
+}
+
+/***********************
+ * meat::JIT::constant *
+ ***********************/
+
+int meat::JIT::constant(frame_t *frame, bytecode::instruction_t *in) {
+  JIT_TRY
+    Class &cls = *frame->cls;
+
+    cast<Context>(*frame->context).local(in->destination) =
+      cls.constant(in - cls._program);
+    return JIT_CONTINUE;
+  JIT_CATCH
+}
+
+/**************************
+ * meat::JIT::block_param *
+ **************************/
+
+int meat::JIT::block_param(frame_t *frame, bytecode::instruction_t *in) {
+  JIT_TRY
+    Context &ctx = cast<Context>(*frame->context);
+
+    Reference block_parameter =
+      new BlockParameter(in->count, ctx.local(in->source));
+    ctx.local(in->destination) = std::move(block_parameter);
+    return JIT_CONTINUE;
+  JIT_CATCH
+}
+
+/***************************
+ * meat::JIT::set_property *
+ ***************************/
+
+int meat::JIT::set_property(frame_t *frame, bytecode::instruction_t *in) {
+  JIT_TRY
+    Reference &context = *frame->context;
+    Reference self;
+    if (in->code == bytecode::SET_PROP) {
+      self = cast<Context>(context).self();
+      if (self.is_immediate() or not self->is_object())
+        throw Exception("Attempting to set an object property to a class.");
+    } else
+      self = cast<Context>(context).klass();
+
+    capture(context, in->source);
+    self->property(in->destination) = cast<Context>(context).local(in->source);
+    return JIT_CONTINUE;
+  JIT_CATCH
+}
+
+/********************
+ * meat::enable_jit *
+ ********************/
+
+bool meat::enable_jit(bool enable) {
+  return JIT::enable(enable);
+}
+
+/***********************
+ * meat::jit_threshold *
+ ***********************/
+
+void meat::jit_threshold(std::uint32_t count) {
+  JIT::threshold = (count ? count : 1);
+}
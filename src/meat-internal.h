@@ -18,10 +18,108 @@
  */
 
 #include <meat.h>
+#include <exception>
 
 #ifndef MEAT_INTERNAL_H
 #define MEAT_INTERNAL_H
 
 meat::Reference &__builtin__library();
 
+/** Bytecode methods are compiled by the JIT once they have been invoked this
+ * many times, unless it's changed with meat::jit_threshold().
+ */
+#ifndef JIT_THRESHOLD
+#define JIT_THRESHOLD 1000
+#endif
+
+namespace meat {
+
+  /** The most parameters a tail send can pass, they're held on the C stack
+   * while the sending context is released.
+   */
+  const std::uint8_t TAIL_PARAMETERS = 8;
+
+  /** Try to answer the MESG_TAIL instruction in by replacing context with the
+   * context of the message, so its frame is reused instead of growing the
+   * stack. This is only done when the send has already been cached to a
+   * bytecode method and nothing but the context's own blocks has captured
+   * it, otherwise false is returned and the instruction is run as a normal
+   * send.
+   */
+  bool message_tail(Reference &context, const bytecode::instruction_t *in);
+
+  /** Called while handling an exception raised by context to look for a
+   * primitive waiting on a block it invoked to catch exceptions, up to the
+   * nearest native method that called execute() itself. If there is one the
+   * exception is handed to it and context is replaced with the finished
+   * context the primitive is waiting on, so unwinding it calls the primitive
+   * again. Exceptions that aren't a std::exception are never caught.
+   * @return True if the exception was caught.
+   * @see Context::invoke()
+   */
+  bool catch_exception(Reference &context);
+
+  /** The template JIT compiles a bytecode method by stitching together a
+   * machine code template for each of its instructions. The templates call
+   * back into the helpers here to do the actual work, which removes the
+   * instruction dispatch and decoding of the interpreter.
+   *
+   *  The native code runs a single context. Whenever the context changes,
+   * like for a send to a bytecode method or when the context ends, the native
+   * code returns back to the interpreter which then carries on from the
+   * context's ip.
+   */
+  class JIT {
+  public:
+    /** The state shared by the native code and the helpers it calls.
+     */
+    typedef struct _frame_s {
+      Reference *context;  // The interpreter's current context.
+      Class *cls;          // The class with the code being run.
+      std::exception_ptr error;
+    } frame_t;
+
+    typedef int (*helper_t)(frame_t *frame, bytecode::instruction_t *in);
+
+    static bool enabled();
+    static bool enable(bool enable);
+
+    /** How many times a bytecode method is invoked before it's compiled.
+     */
+    static std::uint32_t threshold;
+
+    /** Compile the method that starts at the instruction index entry. The
+     * method is left to the interpreter if the JIT can't handle it.
+     */
+    static void compile(Class &cls, std::uint16_t entry);
+
+    /** Run the native code for context until it returns to the interpreter.
+     * Any exception raised while in the native code is raised again here.
+     */
+    static void run(Reference &context, Class *cls, void *code);
+
+  private:
+    static helper_t helper(std::uint8_t code);
+
+    static int send(frame_t *frame, bytecode::instruction_t *in);
+    static int message(frame_t *frame, bytecode::instruction_t *in);
+    static int primitive(frame_t *frame, bytecode::instruction_t *in,
+                         Reference &new_ctx);
+    static int call_native(frame_t *frame, bytecode::instruction_t *in);
+    static int arithmetic(frame_t *frame, bytecode::instruction_t *in);
+    static int block(frame_t *frame, bytecode::instruction_t *in);
+    static int block_inline(frame_t *frame, bytecode::instruction_t *in);
+    static int jump(frame_t *frame, bytecode::instruction_t *in);
+    static int jump_if(frame_t *frame, bytecode::instruction_t *in);
+    static int loop(frame_t *frame, bytecode::instruction_t *in);
+    static int context_end(frame_t *frame, bytecode::instruction_t *in);
+    static int assign(frame_t *frame, bytecode::instruction_t *in);
+    static int get_property(frame_t *frame, bytecode::instruction_t *in);
+    static int load_class(frame_t *frame, bytecode::instruction_t *in);
+    static int constant(frame_t *frame, bytecode::instruction_t *in);
+    static int block_param(frame_t *frame, bytecode::instruction_t *in);
+    static int set_property(frame_t *frame, bytecode::instruction_t *in);
+  };
+}
+
 #endif /* MEAT_INTERNAL_H */
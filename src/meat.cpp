@@ -20,11 +20,17 @@
 #include <meat.h>
 #include <meat/datastore.h>
 #include <meat/utilities.h>
+#include <meat/bytecode.h>
+#include "meat-internal.h"
 
 #include <iostream>
 #include <sstream>
 #include <iomanip>
 #include <cstring>
+#include <new>
+#include <type_traits>
+#include <cmath>
+#include <unordered_set>
 
 #ifdef TESTING
 #include <testing.h>
@@ -34,37 +40,79 @@
  * meat::Object Class
  */
 
+/*  The property slots reserved by the last Object::operator new, until the
+ * Object being allocated claims them. An Object is allocated and constructed
+ * on the same thread, so each thread keeps its own reservation.
+ */
+typedef struct _trailing_s {
+  unsigned char *object;
+  meat::Reference *slots;
+  std::uint8_t count;
+} trailing_t;
+
+static trailing_t &trailing() {
+  static thread_local trailing_t reserved = {nullptr, nullptr, 0};
+  return reserved;
+}
+
+/******************************
+ * meat::Object::operator new *
+ ******************************/
+
+void *meat::Object::operator new(std::size_t size, std::uint8_t properties) {
+  std::size_t offset =
+    (size + alignof(Reference) - 1) & ~(alignof(Reference) - 1);
+  unsigned char *ptr = (unsigned char *)
+    memory::gc::alloc(offset + properties * sizeof(Reference));
+
+  trailing_t &reserved = trailing();
+  reserved.object = ptr;
+  reserved.slots = (Reference *)(ptr + offset);
+  reserved.count = properties;
+  return ptr;
+}
+
+/*********************************
+ * meat::Object::operator delete *
+ *********************************/
+
+void meat::Object::operator delete(void *ptr, std::uint8_t) noexcept {
+  // Only called if the constructor threw before claiming its slots.
+  trailing().object = nullptr;
+  memory::gc::recycle(ptr);
+}
+
 /************************
  * meat::Object::Object *
  ************************/
 
-meat::Object::Object(Reference type) : _type(type), _property(0) {
+meat::Object::Object(Reference type)
+  : _type(std::move(type)), _kind(KIND_OBJECT), _trailing(false),
+    _property(0) {
 #ifdef TESTING
   meat::test::test("Object type setting", false);
-  if (!type.is_null()) {
-    if (!type->is_class())
+  if (!_type.is_null()) {
+    if (!_type->is_class())
       throw Exception("An Object type must be a class.");
   } else {
     meat::test::failed("Object type setting", false);
   }
 #endif
-  _properties = meat::cast<meat::Class>(type).obj_properties();
-  if (_properties > 0) {
-    // Initialize the properties and set them all to Null.
-    _property = new Reference[_properties];
-    for (unsigned int c = 0; c < _properties; c++)
-      _property[c] = Null();
-  }
+  _properties = meat::cast<meat::Class>(_type).obj_properties();
+  init_properties();
+  acyclic(_properties == 0);
+  if (not _type.is_null()) static_cast<Class &>(*_type).created();
 }
 
 meat::Object::Object(Reference type, std::uint8_t properties)
-  : _type(type), _properties(properties), _property(0) {
+  : _type(std::move(type)), _properties(properties), _kind(KIND_OBJECT),
+    _trailing(false), _property(0) {
 #ifdef TESTING
   static bool first_fail = true;
 
   meat::test::test("Object type setting with properties", false);
-  if (!type.is_null()) {
-    if (!type->is_class())
+  if (!_type.is_null()) {
+    if (!_type->is_class())
       throw Exception("An Object type must be a class.");
   } else {
     if (not first_fail)
@@ -72,12 +120,9 @@ meat::Object::Object(Reference type, std::uint8_t properties)
     first_fail = false;
   }
 #endif
-  if (_properties > 0) {
-    // Initialize the properties and set them all to Null.
-    _property = new Reference[_properties];
-    for (unsigned int c = 0; c < _properties; c++)
-      _property[c] = Null();
-  }
+  init_properties();
+  acyclic(_properties == 0);
+  if (not _type.is_null()) static_cast<Class &>(*_type).created();
 }
 
 /*************************
@@ -90,8 +135,41 @@ meat::Object::~Object() throw () {
     execute(message(self, "cleanup", Null()));
   }
   // Clean up all the properties
-  if (_property)
+  if (_trailing) {
+    for (unsigned int c = _properties; c > 0; --c)
+      _property[c - 1].~Reference();
+  } else if (_property) {
     delete [] _property;
+  }
+  if (not _type.is_null()) static_cast<Class &>(*_type)._instances.live--;
+}
+
+/*********************************
+ * meat::Object::init_properties *
+ *********************************/
+
+void meat::Object::init_properties() {
+  /*  If the Object was allocated with room for its properties they're
+   * constructed in place, otherwise they get an array of their own.
+   */
+  trailing_t &reserved = trailing();
+  unsigned char *self = (unsigned char *)this;
+  if (self >= reserved.object and self < (unsigned char *)reserved.slots) {
+    reserved.object = nullptr;
+    if (_properties <= reserved.count) {
+      _property = reserved.slots;
+      _trailing = true;
+      for (unsigned int c = 0; c < _properties; c++)
+        ::new ((void *)&_property[c]) Reference(Null());
+      return;
+    }
+  }
+
+  if (_properties > 0) {
+    _property = new Reference[_properties];
+    for (unsigned int c = 0; c < _properties; c++)
+      _property[c] = Null();
+  }
 }
 
 /*************************
@@ -120,6 +198,23 @@ bool meat::Object::is_type(const std::string &class_name) const {
   return is_type(meat::Class::resolve(class_name));
 }
 
+/*****************
+ * meat::is_type *
+ *****************/
+
+bool meat::is_type(const Reference &object, Reference cls) {
+  if (not object.is_immediate()) return object->is_type(cls);
+
+  // Immediate Integers are tested against the Integer class hierarchy.
+  Reference my_type = Class::core(CORE_INTEGER);
+  while (not my_type.is_null()) {
+    if (my_type == cls)
+      return true;
+    my_type = cast<Class>(my_type).super();
+  }
+  return false;
+}
+
 /***************************
  * meat::Object::serialize *
  ***************************/
@@ -138,13 +233,11 @@ void meat::Object::unserialize(
   std::istream &data_stream __attribute__((unused))) {
 }
 
-/**************************
- * meat::Object::property *
- **************************/
+/******************************
+ * meat::Object::bad_property *
+ ******************************/
 
-meat::Reference &meat::Object::property(std::uint8_t index) {
-  if (index < _properties)
-    return _property[index];
+void meat::Object::bad_property(std::uint8_t index) const {
   std::stringstream msg;
   msg << "Invalid property index " << (unsigned int)index
       << " ( >= " << (unsigned int)_properties << ")"
@@ -152,14 +245,22 @@ meat::Reference &meat::Object::property(std::uint8_t index) {
   throw Exception(msg.str());
 }
 
-const meat::Reference &meat::Object::property(std::uint8_t index) const {
-  if (index < _properties)
-    return _property[index];
-  std::stringstream msg;
-  msg << "Invalid property index " << (unsigned int)index
-      << " ( >= " << (unsigned int)_properties << ")"
-      << std::endl;
-  throw Exception(msg.str());
+/***********************
+ * meat::Object::trace *
+ ***********************/
+
+void meat::Object::trace(tracer &visit) {
+  for (std::uint8_t c = 0; c < _properties; ++c)
+    visit(_property[c]);
+}
+
+/************************
+ * meat::Object::unlink *
+ ************************/
+
+void meat::Object::unlink() {
+  for (std::uint8_t c = 0; c < _properties; ++c)
+    _property[c] = Null();
 }
 
 /******************************************************************************
@@ -194,13 +295,106 @@ static class_registry_t &class_registry() {
   return classes;
 }
 
+/** The names of the core classes in the same order as core_class_t.
+ */
+static const char *core_class_names[meat::CORE_CLASSES] = {
+  "Object", "Class", "Context", "BlockContext", "Null", "Exception",
+  "Boolean", "BlockParameter", "Integer", "Number", "Text", "List", "Set",
+  "Index", "Library", "Archive"
+};
+
+typedef struct _core_class_s {
+  std::uint32_t hash_id;
+  meat::Reference cls;
+} core_class_entry_t;
+
+/** The table of core classes. The classes are filled in as they are
+ * recorded by meat::initialize() and replaced if they are ever recorded
+ * again.
+ */
+static core_class_entry_t *core_classes() {
+  static core_class_entry_t classes[meat::CORE_CLASSES];
+  static bool initialized = false;
+
+  if (not initialized) {
+    for (unsigned int c = 0; c < meat::CORE_CLASSES; ++c)
+      classes[c].hash_id = hash(core_class_names[c]);
+    initialized = true;
+  }
+  return classes;
+}
+
+/** Update the core class table if the class is one of the core classes.
+ */
+static void record_core(std::uint32_t hash_id, const meat::Reference &cls) {
+  core_class_entry_t *classes = core_classes();
+
+  for (unsigned int c = 0; c < meat::CORE_CLASSES; ++c) {
+    if (classes[c].hash_id == hash_id) {
+      classes[c].cls = cls;
+      break;
+    }
+  }
+}
+
+/** The current class hierarchy epoch. Every time the hierarchy changes the
+ * epoch is incremented, invalidating the inline caches and the global method
+ * lookup cache.
+ */
+static std::uint32_t &cache_epoch() {
+  static std::uint32_t epoch = 1;
+
+  return epoch;
+}
+
+/** The number of entries in the global method lookup cache. This must be a
+ * power of 2.
+ */
+#define METHOD_CACHE_SIZE 1024
+
+/** An entry in the global method lookup cache.
+ */
+typedef struct _method_cache_entry_s {
+  std::uint32_t epoch;
+  std::uint32_t class_id;
+  std::uint32_t hash_id;
+  bool class_method;
+  const meat::Class *cls;
+  const meat::vtable_entry_t *m_entry;
+} method_cache_entry_t;
+
+/** The global direct mapped method lookup cache, keyed on the receiver's
+ * class id, the method's hash id and if it's a class method.
+ */
+static method_cache_entry_t *method_cache() {
+  static method_cache_entry_t cache[METHOD_CACHE_SIZE];
+
+  return cache;
+}
+
+static inline unsigned int method_cache_index(std::uint32_t class_id,
+                                              std::uint32_t hash_id,
+                                              bool class_method) {
+  return ((class_id ^ (hash_id * 2654435761u) ^ (class_method ? 1 : 0)) &
+          (METHOD_CACHE_SIZE - 1));
+}
+
+static meat::lookup_stats_t &lookup_statistics() {
+  static meat::lookup_stats_t stats = {0, 0};
+
+  return stats;
+}
+
 /**********************
  * meat::Class::Class *
  **********************/
 
 meat::Class::Class(const std::string &parent, std::uint8_t obj_props)
   : Object(ClassClass(), 0), _hash_id(0), _obj_properties(obj_props),
-    library(NULL), _bytecode_size(0), _bytecode(0), _bytecode_static(true) {
+    library(NULL), _bytecode_size(0), _bytecode(0), _bytecode_static(true),
+    _program(0),
+    _entry_index(0), _native(0), _instances() {
+  kind(KIND_CLASS);
 
   _super = resolve(parent);
 }
@@ -209,7 +403,9 @@ meat::Class::Class(const std::string &parent, std::uint8_t cls_props,
                    std::uint8_t obj_props)
   : Object(ClassClass(), cls_props), _hash_id(0),
     _obj_properties(obj_props), library(NULL), _bytecode_size(0), _bytecode(0),
-    _bytecode_static(true) {
+    _bytecode_static(true), _program(0),
+    _entry_index(0), _native(0), _instances() {
+  kind(KIND_CLASS);
 
   _super = resolve(parent);
 }
@@ -217,14 +413,18 @@ meat::Class::Class(const std::string &parent, std::uint8_t cls_props,
 meat::Class::Class(meat::Reference parent, std::uint8_t obj_props)
   : Object(ClassClass(true), 0), _hash_id(0), _super(parent),
     _obj_properties(obj_props), library(NULL), _bytecode_size(0), _bytecode(0),
-    _bytecode_static(true) {
+    _bytecode_static(true), _program(0),
+    _entry_index(0), _native(0), _instances() {
+  kind(KIND_CLASS);
 }
 
 meat::Class::Class(meat::Reference parent, std::uint8_t cls_props,
                    std::uint8_t obj_props)
   : Object(ClassClass(), cls_props), _hash_id(0), _super(parent),
     _obj_properties(obj_props), library(NULL), _bytecode_size(0), _bytecode(0),
-    _bytecode_static(true) {
+    _bytecode_static(true), _program(0),
+    _entry_index(0), _native(0), _instances() {
+  kind(KIND_CLASS);
 }
 
 /***********************
@@ -233,6 +433,9 @@ meat::Class::Class(meat::Reference parent, std::uint8_t cls_props,
 
 meat::Class::~Class () throw () {
   if (!_bytecode_static && _bytecode != NULL) delete[] _bytecode;
+  if (_program) delete[] _program;
+  if (_entry_index) delete[] _entry_index;
+  if (_native) delete[] _native;
 }
 
 /*******************************
@@ -301,18 +504,21 @@ void meat::Class::set_constructor(constructor_t constructor) {
  * meat::Class::set_vtable *
  ***************************/
 
-void meat::Class::set_vtable(std::uint8_t entries, vtable_entry_t table[],
+void meat::Class::set_vtable(std::uint16_t entries, vtable_entry_t table[],
                              alloc_t table_alloc) {
   vtable.set_vtable(entries, table, table_alloc);
+  InlineCache::flush();
 }
 
 /*********************************
  * meat::Class::set_class_vtable *
  *********************************/
 
-void meat::Class::set_class_vtable(std::uint8_t entries, vtable_entry_t table[],
+void meat::Class::set_class_vtable(std::uint16_t entries,
+                                   vtable_entry_t table[],
                                    alloc_t table_alloc) {
   vtable.set_class_vtable(entries, table, table_alloc);
+  InlineCache::flush();
 }
 
 /*************************
@@ -339,6 +545,7 @@ void meat::Class::bytecode(std::uint16_t size, std::uint8_t *code,
       _bytecode_static = false;
       break;
     }
+    predecode();
   }
 }
 
@@ -351,7 +558,7 @@ const std::uint8_t *meat::Class::bytecode() const {
  ***************************/
 
 const meat::vtable_entry_t *
-meat::Class::get_vtable(std::uint8_t &count) const {
+meat::Class::get_vtable(std::uint16_t &count) const {
   count = vtable.no_entries;
   return vtable.entries;
 }
@@ -361,7 +568,7 @@ meat::Class::get_vtable(std::uint8_t &count) const {
  *********************************/
 
 const meat::vtable_entry_t *
-meat::Class::get_class_vtable(std::uint8_t &count) const {
+meat::Class::get_class_vtable(std::uint16_t &count) const {
   count = vtable.no_centries;
   return vtable.centries;
 }
@@ -418,7 +625,8 @@ void meat::Class::write(std::ostream &lib_file) const {
  * meat::Class::import *
  ***********************/
 
-meat::Class *meat::Class::import(std::istream &lib_file) {
+meat::Class *meat::Class::import(std::istream &lib_file,
+                                 std::uint8_t minor_ver) {
   std::uint32_t class_id;
   lib_file.read((char *)&class_id, 4);
   class_id = endian::read_be(class_id);
@@ -438,7 +646,7 @@ meat::Class *meat::Class::import(std::istream &lib_file) {
   Class *cls = new Class(super, class_props, obj_props);
   cls->_hash_id = class_id;
 
-  cls->vtable.read(lib_file);
+  cls->vtable.read(lib_file, minor_ver >= 1);
 
   // Read in the size of the bytecode.
   lib_file.read((char *)&cls->_bytecode_size, 2);
@@ -449,6 +657,7 @@ meat::Class *meat::Class::import(std::istream &lib_file) {
   lib_file.read((char *)cls->_bytecode, cls->_bytecode_size);
 
   cls->_bytecode_static = false;
+  cls->predecode();
 
   class_registry_t &classes = class_registry();
   if (classes.find(class_id) != classes.end()) {
@@ -486,8 +695,9 @@ void meat::Class::record(Reference &cls, bool replace) {
   }
 
   classes[hash_id] = cls;
-  if (!cast<Class>(cls)._super.is_null())
-    cast<Class>(cls).vtable.link(cast<Class>(cast<Class>(cls)._super));
+  record_core(hash_id, classes[hash_id]);
+  InlineCache::flush();
+  cast<Class>(cls).vtable.link(cast<Class>(cls));
 }
 
 void meat::Class::record(Class *cls, const std::string &id, bool replace) {
@@ -506,10 +716,11 @@ void meat::Class::record(Class *cls, const std::string &id, bool replace) {
   }
 
   classes[hash_id] = cls;
+  record_core(hash_id, classes[hash_id]);
+  InlineCache::flush();
   //cls->_hash_id = hash_id;
   cls->name(id);
-  if (!cls->_super.is_null())
-    cls->vtable.link(cast<Class>(cls->_super));
+  cls->vtable.link(*cls);
 }
 
 void meat::Class::record(Reference &cls, const std::string &id, bool replace) {
@@ -529,10 +740,11 @@ void meat::Class::record(Reference &cls, const std::string &id, bool replace) {
   }
 
   classes[hash_id] = cls;
+  record_core(hash_id, classes[hash_id]);
+  InlineCache::flush();
   //thecls._hash_id = hash_id;
   thecls.name(id);
-  if (!thecls._super.is_null())
-    thecls.vtable.link(cast<Class>(thecls._super));
+  thecls.vtable.link(thecls);
 }
 
 /*************************
@@ -545,6 +757,8 @@ void meat::Class::unrecord(Reference cls, bool compiled) {
             << std::endl;
 #endif
   class_registry().erase(cast<Class>(cls)._hash_id);
+  record_core(cast<Class>(cls)._hash_id, Reference());
+  InlineCache::flush();
 }
 
 /***********************
@@ -555,8 +769,8 @@ void meat::Class::relink() {
 #ifdef DEBUG
   std::cout << "CLASS: Relinking class " << name() << std::endl;
 #endif
-  if (!_super.is_null())
-    vtable.link(cast<Class>(_super));
+  InlineCache::flush();
+  vtable.link(*this);
 }
 
 /************************
@@ -586,6 +800,18 @@ meat::Reference &meat::Class::resolve(std::uint32_t hash_id, bool compiled) {
     return classes[hash_id];
 }
 
+/*********************
+ * meat::Class::core *
+ *********************/
+
+meat::Reference &meat::Class::core(core_class_t cls) {
+  Reference &core_cls = core_classes()[cls].cls;
+
+  if (core_cls.is_null())
+    return resolve(core_class_names[cls]);
+  return core_cls;
+}
+
 /***************************
  * meat::Class::have_class *
  ***************************/
@@ -625,6 +851,353 @@ meat::Class::class_find(std::uint32_t hash_id) const {
   return vtable.class_find(hash_id);
 }
 
+/****************************
+ * meat::Class::find_method *
+ ****************************/
+
+const meat::vtable_entry_t *
+meat::Class::find_method(std::uint32_t hash_id, bool class_method) const {
+  // First check the global method lookup cache.
+  method_cache_entry_t &slot =
+    method_cache()[method_cache_index(_hash_id, hash_id, class_method)];
+  if (slot.epoch == cache_epoch() and slot.cls == this and
+      slot.class_id == _hash_id and slot.hash_id == hash_id and
+      slot.class_method == class_method) {
+    lookup_statistics().hits++;
+    return slot.m_entry;
+  }
+  lookup_statistics().misses++;
+
+  /*  The flattened dispatch tables already have the inherited methods, so
+   * there's no need to look through the super classes. The tables are
+   * rebuilt if the class hierarchy has changed since they were flattened.
+   */
+  if (vtable.d_epoch != cache_epoch()) vtable.flatten(*this);
+  const vtable_entry_t *m_entry = vtable.dispatch(hash_id, class_method);
+  if (m_entry) {
+    slot.epoch = cache_epoch();
+    slot.class_id = _hash_id;
+    slot.hash_id = hash_id;
+    slot.class_method = class_method;
+    slot.cls = this;
+    slot.m_entry = m_entry;
+  }
+  return m_entry;
+}
+
+/**************************
+ * meat::Class::predecode *
+ **************************/
+
+void meat::Class::predecode() {
+  // Any send site caches, constants and native code belong to the old
+  // bytecode.
+  if (_program) delete[] _program;
+  if (_entry_index) delete[] _entry_index;
+  if (_native) delete[] _native;
+  _native = 0;
+  _caches.clear();
+  _constants.clear();
+
+  _entry_index = new std::uint16_t[_bytecode_size + 1];
+  std::memset(_entry_index, 0xff, sizeof(std::uint16_t) * _bytecode_size);
+
+  /*  The first pass decodes each instruction leaving the offset of the next
+   * instruction in next. Once all the instructions are indexed the second
+   * pass turns the offsets into indexes.
+   */
+  std::vector<bytecode::instruction_t> program;
+  std::uint16_t ip = 0;
+  bool known = true;
+  while (known and ip < _bytecode_size) {
+    bytecode::bytecode_t *bc = (bytecode::bytecode_t *)&_bytecode[ip];
+    bytecode::instruction_t in;
+    std::memset(&in, 0, sizeof(bytecode::instruction_t));
+    in.code = bc->code;
+    in.offset = ip;
+
+    std::uint16_t length = 1;
+    switch (bc->code) {
+    case bytecode::NOOP:
+    case bytecode::CONTEXT_END:
+      break;
+    case bytecode::MESSAGE:
+    case bytecode::MESG_SUPER:
+      in.source = bc->o.m.object;
+      in.count = bc->o.m.parameters;
+      in.value = endian::read_be(bc->o.m.message_id);
+      in.parameter = bc->o.m.parameter;
+      _caches.emplace_back();
+      in.cache = &_caches.back();
+      length = 7 + in.count;
+      break;
+    case bytecode::MESG_RESULT:
+    case bytecode::MESG_SUPER_RESULT:
+    case bytecode::MESG_TAIL:
+      in.destination = bc->o.mr.result;
+      in.source = bc->o.mr.object;
+      in.count = bc->o.mr.parameters;
+      in.value = endian::read_be(bc->o.mr.message_id);
+      in.parameter = bc->o.mr.parameter;
+      _caches.emplace_back();
+      in.cache = &_caches.back();
+      length = 8 + in.count;
+      break;
+    case bytecode::BLOCK:
+      /* The block's code follows inline, so we step into it while execution
+       * continues after it.
+       */
+      in.destination = bc->o.bc.result;
+      in.count = bc->o.bc.locals;
+      length = 5;
+      in.next = ip + endian::read_be(bc->o.bc.code_size) + 5;
+      break;
+    case bytecode::BLOCK_INLINE:
+      in.destination = bc->o.bi.result;
+      in.target = ip + endian::read_be(bc->o.bi.body);
+      length = 4;
+      break;
+    case bytecode::JUMP:
+      in.target = ip + endian::read_be(bc->o.j.target);
+      if (bc->o.j.block) in.guard = ip + endian::read_be(bc->o.j.block);
+      length = 5;
+      break;
+    case bytecode::JUMP_IF_TRUE:
+    case bytecode::JUMP_IF_FALSE:
+      in.source = bc->o.ji.condition;
+      in.target = ip + endian::read_be(bc->o.ji.target);
+      in.guard = ip + endian::read_be(bc->o.ji.guard);
+      length = 6;
+      break;
+    case bytecode::LOOP:
+      in.source = bc->o.l.limit;
+      in.destination = bc->o.l.count;
+      in.target = ip + endian::read_be(bc->o.l.target);
+      in.guard = ip + endian::read_be(bc->o.l.guard);
+      length = 7;
+      break;
+    case bytecode::ASSIGN:
+      in.destination = bc->o.a.destination;
+      in.source = bc->o.a.source;
+      length = 3;
+      break;
+    case bytecode::ASSIGN_PROP:
+    case bytecode::ASSIGN_CLASS_PROP:
+      in.destination = bc->o.ap.destination;
+      in.source = bc->o.ap.property_id;
+      length = 3;
+      break;
+    case bytecode::ASSIGN_CLASS:
+      in.destination = bc->o.c.destination;
+      in.value = endian::read_be(bc->o.c.class_id);
+      in.slot = _constants.size();
+      _constants.emplace_back(); // The resolved class once quickened
+      length = 6;
+      break;
+    case bytecode::ASSIGN_CONST_INT:
+    case bytecode::ASSIGN_CONST_NUM:
+    case bytecode::ASSIGN_CONST_TXT:
+      in.destination = bc->o.ci.destination;
+      in.slot = _constants.size();
+      _constants.emplace_back();
+      if (bc->code == bytecode::ASSIGN_CONST_INT)
+        length = 6;
+      else if (bc->code == bytecode::ASSIGN_CONST_NUM)
+        length = 14;
+      else
+        length = std::strlen((const char *)bc->o.ct.value) + 3;
+      break;
+    case bytecode::ASSIGN_BLOCK_PARAM:
+      in.destination = bc->o.bp.destination;
+      in.source = bc->o.bp.block;
+      in.count = bc->o.bp.local_index;
+      length = 4;
+      break;
+    case bytecode::SET_PROP:
+    case bytecode::SET_CLASS_PROP:
+      in.destination = bc->o.sp.destination;
+      in.source = bc->o.sp.source;
+      length = 3;
+      break;
+    default:
+      /* The interpreter raises the exception if it ever gets here, so leave
+       * the rest of the bytecode undecoded.
+       */
+      known = false;
+      length = 0;
+      break;
+    }
+
+    if (in.code == bytecode::MESSAGE or in.code == bytecode::MESG_RESULT or
+        in.code == bytecode::MESG_TAIL) {
+      // The receiver's class and the method's class once quickened.
+      in.slot = _constants.size();
+      _constants.emplace_back();
+      _constants.emplace_back();
+    }
+
+    if (in.code != bytecode::BLOCK) in.next = ip + length;
+    _entry_index[ip] = program.size();
+    program.push_back(in);
+    ip += length;
+  }
+
+  /* Methods always end with CONTEXT_END, but just in case the instructions
+   * are capped with one so execution can never run off the end.
+   */
+  bytecode::instruction_t end;
+  std::memset(&end, 0, sizeof(bytecode::instruction_t));
+  end.code = bytecode::CONTEXT_END;
+  end.offset = _bytecode_size;
+  end.next = _bytecode_size;
+  _entry_index[_bytecode_size] = program.size();
+  program.push_back(end);
+
+  auto resolve = [this](std::uint16_t &offset) {
+    if (offset > _bytecode_size or _entry_index[offset] == 0xffff) {
+      throw Exception(std::string("Invalid bytecode jump in class ") + _name);
+    }
+    offset = _entry_index[offset];
+  };
+
+  _program = new bytecode::instruction_t[program.size()];
+  for (std::size_t c = 0; c < program.size(); c++) {
+    bytecode::instruction_t &in = _program[c];
+    in = program[c];
+    resolve(in.next);
+
+    switch (in.code) {
+    case bytecode::JUMP:
+      resolve(in.target);
+      if (in.guard) resolve(in.guard);
+      break;
+    case bytecode::JUMP_IF_TRUE:
+    case bytecode::JUMP_IF_FALSE:
+    case bytecode::LOOP:
+      resolve(in.guard);
+      // Fall through
+    case bytecode::BLOCK_INLINE:
+      resolve(in.target);
+      break;
+    }
+  }
+}
+
+/**********************
+ * meat::Class::entry *
+ **********************/
+
+std::uint16_t meat::Class::entry(std::uint16_t offset) const {
+  if (offset > _bytecode_size or _entry_index[offset] == 0xffff) {
+    throw Exception(std::string("Invalid method entry point in class ") +
+                    _name);
+  }
+  return _entry_index[offset];
+}
+
+/*************************
+ * meat::Class::constant *
+ *************************/
+
+const meat::Reference &meat::Class::constant(std::uint16_t index) {
+  Reference &literal = _constants[_program[index].slot];
+
+  if (literal.is_null()) {
+    /* Literals are created on first use rather than when the bytecode is
+     * indexed, the builtin classes get their bytecode before Integer, Number
+     * and Text are recorded.
+     */
+    bytecode::bytecode_t *bc =
+      (bytecode::bytecode_t *)&_bytecode[_program[index].offset];
+    switch (bc->code) {
+    case bytecode::ASSIGN_CONST_INT:
+      literal = Integer(endian::read_be(bc->o.ci.value));
+      break;
+    case bytecode::ASSIGN_CONST_NUM: {
+      double mantissa = ldexp(endian::read_be(bc->o.cn.mantissa), -53);
+      literal = new Value(ldexp(mantissa, endian::read_be(bc->o.cn.exponent)));
+      break;
+    }
+    case bytecode::ASSIGN_CONST_TXT:
+      literal = new Text((const char *)bc->o.ct.value);
+      break;
+    }
+  }
+  return literal;
+}
+
+/*************************
+ * meat::Class::quicken  *
+ *************************/
+
+/** After this many deoptimizations an instruction is left in its generic
+ * form, so sends that keep changing receivers don't keep flip flopping.
+ */
+#define QUICKEN_LIMIT 2
+
+void meat::Class::quicken(std::uint16_t index, Reference &context) {
+  static const std::uint32_t add_id = hash("+");
+  static const std::uint32_t sub_id = hash("-");
+
+  bytecode::instruction_t &in = _program[index];
+  if (in.deopts >= QUICKEN_LIMIT) return;
+
+  switch (in.code) {
+  case bytecode::MESSAGE:
+  case bytecode::MESG_RESULT:
+  case bytecode::MESG_TAIL: {
+    /*  Only sends to objects that resolved to a native method are quickened,
+     * sends to classes would need the guard to test for the class itself.
+     */
+    Reference object = cast<Context>(context).local(in.source);
+    Reference obj_cls, klass;
+    const vtable_entry_t *m_entry = nullptr;
+    if (not object.is_null() and not meat::is_class(object)) {
+      obj_cls = type_of(object);
+      m_entry = in.cache->find(obj_cls, false, klass);
+    }
+    if (m_entry == nullptr or (m_entry->flags & VTM_BYTECODE)) {
+      // Don't bother trying again.
+      in.deopts = QUICKEN_LIMIT;
+      return;
+    }
+
+    in.generic = in.code;
+    in.epoch = cache_epoch();
+    in.method = m_entry;
+    _constants[in.slot] = obj_cls.weak();
+    _constants[in.slot + 1] = klass.weak();
+
+    // Integer addition and subtraction skip the method call altogether.
+    Reference &integer = Class::core(CORE_INTEGER);
+    if (in.code != bytecode::MESSAGE and in.count == 1 and
+        obj_cls == integer and klass == integer and
+        (in.value == add_id or in.value == sub_id)) {
+      Reference other = cast<Context>(context).local(in.parameter[0]);
+      if (not other.is_null() and type_of(other) == integer) {
+        in.code = (in.value == add_id ? bytecode::INT_ADD : bytecode::INT_SUB);
+        break;
+      }
+    }
+
+    in.code = (in.code == bytecode::MESSAGE ? bytecode::CALL_NATIVE :
+               bytecode::CALL_NATIVE_RESULT);
+    break;
+  }
+
+  case bytecode::ASSIGN_CLASS:
+    in.generic = in.code;
+    in.epoch = cache_epoch();
+    _constants[in.slot] =
+      cast<Context>(context).local(in.destination).weak();
+    in.code = bytecode::LOAD_RESOLVED_CLASS;
+    break;
+
+  default:
+    break;
+  }
+}
+
 /*********************************************
  * meat::Class::operator meat::Reference &() *
  *********************************************/
@@ -633,6 +1206,89 @@ meat::Class::operator meat::Reference &() const {
   return resolve(_hash_id);
 }
 
+/******************************************************************************
+ * meat::InlineCache Class
+ */
+
+/**********************************
+ * meat::InlineCache::InlineCache *
+ **********************************/
+
+meat::InlineCache::InlineCache()
+  : epoch(cache_epoch()), used(0), megamorphic(false) {
+}
+
+/***************************
+ * meat::InlineCache::find *
+ ***************************/
+
+const meat::vtable_entry_t *
+meat::InlineCache::find(Reference &receiver, bool is_class,
+                        Reference &klass) {
+  if (epoch != cache_epoch()) {
+    clear();
+    return nullptr;
+  }
+
+  for (std::uint8_t c = 0; c < used; ++c) {
+    if (entries[c].receiver == receiver and
+        entries[c].is_class == is_class) {
+      if (entries[c].klass.is_null()) return nullptr;
+      klass = entries[c].klass.normal();
+      return entries[c].m_entry;
+    }
+  }
+  return nullptr;
+}
+
+/**************************
+ * meat::InlineCache::add *
+ **************************/
+
+void meat::InlineCache::add(Reference &receiver, bool is_class,
+                            const vtable_entry_t *m_entry, Reference &klass) {
+  if (epoch != cache_epoch()) clear();
+
+  if (used < ENTRIES) {
+    entries[used].receiver = receiver.weak();
+    entries[used].is_class = is_class;
+    entries[used].m_entry = m_entry;
+    entries[used].klass = klass.weak();
+    used++;
+  } else
+    megamorphic = true;
+}
+
+/****************************
+ * meat::InlineCache::flush *
+ ****************************/
+
+void meat::InlineCache::flush() {
+  cache_epoch()++;
+}
+
+/******************************
+ * meat::InlineCache::current *
+ ******************************/
+
+const std::uint32_t &meat::InlineCache::current() {
+  return cache_epoch();
+}
+
+/****************************
+ * meat::InlineCache::clear *
+ ****************************/
+
+void meat::InlineCache::clear() {
+  for (std::uint8_t c = 0; c < used; ++c) {
+    entries[c].receiver = Reference();
+    entries[c].klass = Reference();
+  }
+  used = 0;
+  megamorphic = false;
+  epoch = cache_epoch();
+}
+
 /******************************************************************************
  * meat::Class::VTable Class
  */
@@ -649,6 +1305,7 @@ meat::Class::VTable::VTable() {
   centries = (vtable_entry_t *)0;
   ce_is_static = true;
   constructor = 0;
+  d_epoch = 0;
 }
 
 /********************************
@@ -666,14 +1323,14 @@ meat::Class::VTable::~VTable() throw() {
  * meat::Class::Vtable::set_vtable *
  ***********************************/
 
-void meat::Class::VTable::set_vtable(std::uint8_t entries,
+void meat::Class::VTable::set_vtable(std::uint16_t entries,
                                      vtable_entry_t table[],
                                      alloc_t table_alloc) {
 
 #ifdef TESTING
   // All we can really test here is the entries are sorted by the hash value.
   meat::test::test("Class virtual table validation", false);
-  for (std::uint8_t c = 1; c < entries; c++) {
+  for (std::uint16_t c = 1; c < entries; c++) {
     if (table[c - 1].hash_id >= table[c].hash_id) {
       meat::test::failed("Class virtual table validation", false);
       break;
@@ -703,13 +1360,13 @@ void meat::Class::VTable::set_vtable(std::uint8_t entries,
  * meat::Class::Vtable::set_class_vtable *
  *****************************************/
 
-void meat::Class::VTable::set_class_vtable(std::uint8_t entries,
+void meat::Class::VTable::set_class_vtable(std::uint16_t entries,
                                            vtable_entry_t table[],
                                            alloc_t table_alloc) {
 #ifdef TESTING
   // All we can really test here is the entries are sorted by the hash value.
   meat::test::test("Class class virtual table validation", false);
-  for (std::uint8_t c = 1; c < entries; c++) {
+  for (std::uint16_t c = 1; c < entries; c++) {
     if (table[c - 1].hash_id >= table[c].hash_id) {
       meat::test::failed("Class class virtual table validation", false);
       break;
@@ -753,41 +1410,156 @@ void meat::Class::VTable::set(constructor_t constructor) {
  * meat::Class::Vtable::link *
  *****************************/
 
-void meat::Class::VTable::link(Class &super) {
+void meat::Class::VTable::link(const Class &cls) {
 #ifdef DEBUG
   std::cout << "VTABLE: Linking" << std::endl;
 #endif
-  for (unsigned int c = 0; c < no_entries; ++c) {
-    if (entries[c].flags & VTM_SUPER) {
-      vtable_entry_t *other = super.vtable.find(entries[c].hash_id);
-      if (other) {
-        std::memcpy(&entries[c], other, sizeof(vtable_entry_t));
-        entries[c].flags |= VTM_SUPER;
+  /*  Inherited entries are resolved through the super class's dispatch
+   * tables. If the super class can't resolve it either then its own entry is
+   * copied as is, so the entry stays unresolved and flatten() skips it.
+   */
+  if (not cls._super.is_null()) {
+    const Class &super = cast<const Class>(cls._super);
+
+    for (unsigned int c = 0; c < no_entries; ++c) {
+      if (entries[c].flags & VTM_SUPER) {
+        const vtable_entry_t *other =
+          super.find_method(entries[c].hash_id, false);
+        if (not other) other = super.vtable.find(entries[c].hash_id);
+        if (other) {
+          std::memcpy(&entries[c], other, sizeof(vtable_entry_t));
+          entries[c].flags |= VTM_SUPER;
+        }
+#ifdef TESTING
+        // This doesn't cause any problems, but is for quality control.
+        else
+          std::cerr << "VTABLE: Linking error for "
+                    << std::hex << entries[c].hash_id << std::dec
+                    << std::endl;
+#endif
       }
+    }
+    for (unsigned int c = 0; c < no_centries; ++c) {
+      if (centries[c].flags & VTM_SUPER) {
+        const vtable_entry_t *other =
+          super.find_method(centries[c].hash_id, true);
+        if (not other) other = super.vtable.class_find(centries[c].hash_id);
+        if (other) {
+          std::memcpy(&centries[c], other, sizeof(vtable_entry_t));
+          centries[c].flags |= VTM_SUPER;
+        }
 #ifdef TESTING
-      // This doesn't cause any problems, but is for quality control.
-      else
-        std::cerr << "VTABLE: Linking error for "
-                  << std::hex << entries[c].hash_id << std::dec
-                  << std::endl;
+        // This doesn't cause any problems, but is for quality control.
+        else
+          std::cerr << "VTABLE: Class linking error for "
+                    << std::hex << centries[c].hash_id << std::dec
+                    << std::endl;
 #endif
+      }
     }
   }
-  for (unsigned int c = 0; c < no_centries; ++c) {
-    if (centries[c].flags & VTM_SUPER) {
-      vtable_entry_t *other = super.vtable.class_find(centries[c].hash_id);
-      if (other) {
-        std::memcpy(&centries[c], other, sizeof(vtable_entry_t));
-        centries[c].flags |= VTM_SUPER;
+  flatten(cls);
+}
+
+/********************************
+ * meat::Class::Vtable::flatten *
+ ********************************/
+
+void meat::Class::VTable::flatten(const Class &cls) const {
+  std::vector<const vtable_entry_t *> methods, cmethods;
+  std::unordered_set<std::uint32_t> seen, cseen;
+
+  /*  Collect the methods starting with the class itself, an entry in a sub
+   * class overrides any entry with the same hash id further up. Inherited
+   * entries that haven't been linked yet are skipped so the super class's
+   * own entry is used.
+   */
+  for (const Class *c = &cls; c; ) {
+    const VTable &vt = c->vtable;
+    for (unsigned int e = 0; e < vt.no_entries; ++e) {
+      if (vt.entries[e].flags == VTM_SUPER) continue;
+      if (seen.insert(vt.entries[e].hash_id).second)
+        methods.push_back(&vt.entries[e]);
+    }
+    for (unsigned int e = 0; e < vt.no_centries; ++e) {
+      if (vt.centries[e].flags == VTM_SUPER) continue;
+      if (cseen.insert(vt.centries[e].hash_id).second)
+        cmethods.push_back(&vt.centries[e]);
+    }
+
+    if (c->_super.is_null()) break;
+    c = &cast<const Class>(c->_super);
+  }
+
+  build(d_entries, methods);
+  build(d_centries, cmethods);
+  d_epoch = cache_epoch();
+}
+
+/*********************************
+ * meat::Class::Vtable::dispatch *
+ *********************************/
+
+const meat::vtable_entry_t *
+meat::Class::VTable::dispatch(std::uint32_t hash_id, bool class_method) const {
+  const dispatch_t &table = (class_method ? d_centries : d_entries);
+  const vtable_entry_t *m_entry =
+    table.slots[(hash_id * table.mult[0]) >> table.shift];
+  if (m_entry and m_entry->hash_id == hash_id) return m_entry;
+  m_entry = table.slots[(hash_id * table.mult[1]) >> table.shift];
+  if (m_entry and m_entry->hash_id == hash_id) return m_entry;
+  return nullptr;
+}
+
+/******************************
+ * meat::Class::Vtable::build *
+ ******************************/
+
+void meat::Class::VTable::build(
+  dispatch_t &table, const std::vector<const vtable_entry_t *> &methods) {
+  unsigned int bits = 1;
+
+  // Keep the table at most half full.
+  while ((1u << bits) < methods.size() * 2) ++bits;
+
+  table.mult[0] = 0x9e3779b1;
+  table.mult[1] = 0x85ebca6b;
+
+  for (unsigned int attempt = 1; ; ++attempt) {
+    table.shift = 32 - bits;
+    table.slots.assign(1u << bits, nullptr);
+
+    bool placed = true;
+    for (auto method: methods) {
+      const vtable_entry_t *m_entry = method;
+      std::uint32_t pos = (m_entry->hash_id * table.mult[0]) >> table.shift;
+
+      /*  Put the entry in its first slot, any entry that was there is moved
+       * to its other slot until an empty slot is found.
+       */
+      for (unsigned int kicks = 0; m_entry and kicks < 4 * bits + 8;
+           ++kicks) {
+        std::swap(m_entry, table.slots[pos]);
+        if (m_entry) {
+          std::uint32_t first = (m_entry->hash_id * table.mult[0]) >>
+            table.shift;
+          pos = (pos == first ?
+                 (m_entry->hash_id * table.mult[1]) >> table.shift : first);
+        }
+      }
+      if (m_entry) {
+        placed = false;
+        break;
       }
-#ifdef TESTING
-      // This doesn't cause any problems, but is for quality control.
-      else
-        std::cerr << "VTABLE: Class linking error for "
-                  << std::hex << centries[c].hash_id << std::dec
-                  << std::endl;
-#endif
     }
+    if (placed) return;
+
+    // Try again with new hashes, growing the table every few tries.
+    table.mult[0] = table.mult[0] * 0x2c1b3c6d + 0x297a2d39;
+    table.mult[1] = (table.mult[1] ^ (table.mult[1] >> 15)) * 0x27d4eb2f;
+    table.mult[0] |= 1;
+    table.mult[1] |= 1;
+    if (attempt % 4 == 0) ++bits;
   }
 }
 
@@ -802,14 +1574,11 @@ meat::Class::VTable::find(std::uint32_t hash_id) {
   /*  Simple binary search for entries. Note that all the entries must be
    * sorted.
    */
-  if (no_entries > 0) {
-    while (lo <= hi) {
-      pivot = (hi + lo) >> 1;
-      int res = hash_id - entries[pivot].hash_id;
-      if (res == 0) return &entries[pivot];
-      else if (res < 0) hi = pivot - 1;
-      else if (res > 0) lo = pivot + 1;
-    }
+  while (lo <= hi) {
+    pivot = (hi + lo) >> 1;
+    if (hash_id == entries[pivot].hash_id) return &entries[pivot];
+    else if (hash_id < entries[pivot].hash_id) hi = pivot - 1;
+    else lo = pivot + 1;
   }
   return nullptr;
 }
@@ -821,14 +1590,11 @@ meat::Class::VTable::find(std::uint32_t hash_id) const {
   /*  Simple binary search for entries. Note that all the entries must be
    * sorted.
    */
-  if (no_entries > 0) {
-    while (lo <= hi) {
-      pivot = (hi + lo) >> 1;
-      int res = hash_id - entries[pivot].hash_id;
-      if (res == 0) return &entries[pivot];
-      else if (res < 0) hi = pivot - 1;
-      else if (res > 0) lo = pivot + 1;
-    }
+  while (lo <= hi) {
+    pivot = (hi + lo) >> 1;
+    if (hash_id == entries[pivot].hash_id) return &entries[pivot];
+    else if (hash_id < entries[pivot].hash_id) hi = pivot - 1;
+    else lo = pivot + 1;
   }
   return nullptr;
 }
@@ -839,38 +1605,32 @@ meat::Class::VTable::find(std::uint32_t hash_id) const {
 
 meat::vtable_entry_t *
 meat::Class::VTable::class_find(std::uint32_t hash_id) {
-  int lo = 0, hi = no_centries, pivot;
+  int lo = 0, hi = no_centries - 1, pivot;
 
   /*  Simple binary search for class entries. Note that all the class
    * entries must be sorted.
    */
-  if (no_centries > 0) {
-    while (lo <= hi) {
-      pivot = (hi + lo) >> 1;
-      int res = hash_id - centries[pivot].hash_id;
-      if (res == 0) return &centries[pivot];
-      else if (res < 0) hi = pivot - 1;
-      else if (res > 0) lo = pivot + 1;
-    }
+  while (lo <= hi) {
+    pivot = (hi + lo) >> 1;
+    if (hash_id == centries[pivot].hash_id) return &centries[pivot];
+    else if (hash_id < centries[pivot].hash_id) hi = pivot - 1;
+    else lo = pivot + 1;
   }
   return 0;
 }
 
 const meat::vtable_entry_t *
 meat::Class::VTable::class_find(std::uint32_t hash_id) const {
-  int lo = 0, hi = no_centries, pivot;
+  int lo = 0, hi = no_centries - 1, pivot;
 
   /*  Simple binary search for class entries. Note that all the class
    * entries must be sorted.
    */
-  if (no_centries > 0) {
-    while (lo <= hi) {
-      pivot = (hi + lo) >> 1;
-      int res = hash_id - centries[pivot].hash_id;
-      if (res == 0) return &centries[pivot];
-      else if (res < 0) hi = pivot - 1;
-      else if (res > 0) lo = pivot + 1;
-    }
+  while (lo <= hi) {
+    pivot = (hi + lo) >> 1;
+    if (hash_id == centries[pivot].hash_id) return &centries[pivot];
+    else if (hash_id < centries[pivot].hash_id) hi = pivot - 1;
+    else lo = pivot + 1;
   }
   return 0;
 }
@@ -882,10 +1642,13 @@ meat::Class::VTable::class_find(std::uint32_t hash_id) const {
 void meat::Class::VTable::write(std::ostream &lib_file) const {
   static unsigned int zero = 0;
 
-  lib_file.put(no_entries);
-  lib_file.put(no_centries);
+  // The table sizes are 16bit since version 1.1 of the library format.
+  std::uint16_t cooked_size = endian::write_be(no_entries);
+  lib_file.write((const char *)&cooked_size, 2);
+  cooked_size = endian::write_be(no_centries);
+  lib_file.write((const char *)&cooked_size, 2);
 
-  for (std::uint_fast8_t c = 0; c < no_entries; c++) {
+  for (unsigned int c = 0; c < no_entries; c++) {
     if ((entries[c].flags & VTM_BYTECODE) == 0 &&
         !(entries[c].flags & VTM_SUPER)) {
       throw Exception("I can't serialize native classes.");
@@ -910,7 +1673,7 @@ void meat::Class::VTable::write(std::ostream &lib_file) const {
   }
 
   // Write the class methods virtual table.
-  for (std::uint_fast8_t c = 0; c < no_centries; c++) {
+  for (unsigned int c = 0; c < no_centries; c++) {
     if ((centries[c].flags & VTM_BYTECODE) == 0 &&
         !(centries[c].flags & VTM_SUPER)) {
       throw Exception("I can't serialize native classes.");
@@ -939,16 +1702,23 @@ void meat::Class::VTable::write(std::ostream &lib_file) const {
  * meat::Class::Vtable::read *
  *****************************/
 
-void meat::Class::VTable::read(std::istream &lib_file) {
+void meat::Class::VTable::read(std::istream &lib_file, bool wide_sizes) {
   // TODO Should make sure old tables are deallocated first.
 
   // Read in the virtual table sizes.
-  no_entries = lib_file.get();
-  no_centries = lib_file.get();
+  if (wide_sizes) {
+    lib_file.read((char *)&no_entries, 2);
+    no_entries = endian::read_be(no_entries);
+    lib_file.read((char *)&no_centries, 2);
+    no_centries = endian::read_be(no_centries);
+  } else {
+    no_entries = lib_file.get();
+    no_centries = lib_file.get();
+  }
 
   // Read in the object method virtual table.
   entries = new vtable_entry_t[no_entries];
-  for (std::uint_fast8_t c = 0; c < no_entries; c++) {
+  for (unsigned int c = 0; c < no_entries; c++) {
     std::uint32_t hash_id, class_id;
     lib_file.read((char *)&hash_id, 4);
     entries[c].hash_id = endian::read_be(hash_id);
@@ -961,12 +1731,13 @@ void meat::Class::VTable::read(std::istream &lib_file) {
     std::uint16_t offset;
     lib_file.read((char *)&offset, 2);
     entries[c].method.offset = endian::read_be(offset);
+    entries[c].invocations = 0;
   }
   e_is_static = false;
 
   // Read in the class methods virtual table.
   centries = new vtable_entry_t[no_centries];
-  for (std::uint_fast8_t c = 0; c < no_centries; c++) {
+  for (unsigned int c = 0; c < no_centries; c++) {
     std::uint32_t hash_id, class_id;
     lib_file.read((char *)&hash_id, 4);
     centries[c].hash_id = endian::read_be(hash_id);
@@ -979,10 +1750,132 @@ void meat::Class::VTable::read(std::istream &lib_file) {
     std::uint16_t offset;
     lib_file.read((char *)&offset, 2);
     centries[c].method.offset = endian::read_be(offset);
+    centries[c].invocations = 0;
   }
   ce_is_static = false;
 }
 
+/******************************************************************************
+ * Context Frame Stack
+ *
+ *  Most contexts only live as long as the message they were created for, so
+ * their local variables are allocated from a stack of frames instead of the
+ * heap. Frames are released in any order but the stack only shrinks when the
+ * top frame is released. A context that is captured is promoted to the heap
+ * with Context::promote() so it doesn't pin the stack.
+ */
+
+/** The number of Reference slots in each segment of the frame stack.
+ */
+#define FRAME_SEGMENT_SLOTS 8192
+#define NO_FRAME            0xffffffff
+
+/** Every frame on the stack starts with a header that takes a single
+ * Reference slot, followed by the slots for the local variables.
+ */
+typedef struct _frame_header_s {
+  std::uint32_t prev;    // Slot of the previous frame's header.
+  std::uint16_t slots;   // The number of local variable slots.
+  bool released;         // The context has released the frame.
+} frame_header_t;
+
+typedef std::aligned_storage<sizeof(meat::Reference),
+                             alignof(meat::Reference)>::type frame_slot_t;
+
+static_assert(sizeof(frame_header_t) <= sizeof(frame_slot_t),
+              "Frame header doesn't fit in a frame slot");
+
+/** A single contiguous segment of the frame stack.
+ */
+typedef struct _frame_segment_s {
+  struct _frame_segment_s *prev;
+  std::uint32_t top;     // The next free slot.
+  std::uint32_t last;    // Slot of the top frame's header.
+  frame_slot_t slots[FRAME_SEGMENT_SLOTS];
+} frame_segment_t;
+
+/** The frame stack. The stack is never freed since contexts may be released
+ * during program termination.
+ */
+typedef struct _frame_stack_s {
+  frame_segment_t *current;
+  frame_segment_t *spare;   // An empty segment kept to avoid thrashing.
+} frame_stack_t;
+
+static frame_stack_t &frame_stack() {
+  static frame_stack_t stack = {nullptr, nullptr};
+
+  return stack;
+}
+
+/***************
+ * frame_alloc *
+ ***************/
+
+static meat::Reference *frame_alloc(std::uint16_t slots) {
+  frame_stack_t &stack = frame_stack();
+  frame_segment_t *segment = stack.current;
+
+  if (segment == nullptr or
+      segment->top + slots + 1 > FRAME_SEGMENT_SLOTS) {
+    // Push a new segment onto the stack.
+    frame_segment_t *new_segment = stack.spare;
+    if (new_segment) stack.spare = nullptr;
+    else new_segment = new frame_segment_t;
+
+    new_segment->prev = segment;
+    new_segment->top = 0;
+    new_segment->last = NO_FRAME;
+    stack.current = segment = new_segment;
+  }
+
+  frame_header_t *header = (frame_header_t *)&segment->slots[segment->top];
+  header->prev = segment->last;
+  header->slots = slots;
+  header->released = false;
+
+  meat::Reference *locals =
+    (meat::Reference *)&segment->slots[segment->top + 1];
+  for (std::uint16_t c = 0; c < slots; ++c)
+    ::new ((void *)&locals[c]) meat::Reference();
+
+  segment->last = segment->top;
+  segment->top += slots + 1;
+  return locals;
+}
+
+/*****************
+ * frame_release *
+ *****************/
+
+static void frame_release(meat::Reference *locals, std::uint16_t slots) {
+  /*  Releasing the local variables can destroy other contexts, so the frame
+   * is only flagged as released once they are all gone.
+   */
+  for (std::uint16_t c = 0; c < slots; ++c)
+    locals[c].~reference<meat::Object>();
+  ((frame_header_t *)((frame_slot_t *)locals - 1))->released = true;
+
+  // Pop all the released frames off the top of the stack.
+  frame_stack_t &stack = frame_stack();
+  while (stack.current) {
+    frame_segment_t *segment = stack.current;
+
+    while (segment->last != NO_FRAME) {
+      frame_header_t *header = (frame_header_t *)&segment->slots[segment->last];
+      if (not header->released) return;
+      segment->top = segment->last;
+      segment->last = header->prev;
+    }
+
+    // The segment is empty so drop back to the previous segment.
+    if (segment->prev == nullptr) return;
+    stack.current = segment->prev;
+    if (stack.spare) delete stack.spare;
+    stack.spare = segment;
+  }
+}
+
 /******************************************************************************
  * meat::Context Class
  */
@@ -995,24 +1888,42 @@ static const std::uint8_t CFL_NATIVE   = 0x01;
  **************************/
 
 meat::Context::Context(std::uint8_t locals)
-  : Object(Class::resolve("Context")), _result_index(0), done(false) {
+  : Object(Class::core(CORE_CONTEXT)), _result_index(0), done(false),
+    _on_stack(false), _invoke(0), _steps(0) {
+  kind(KIND_CONTEXT);
   num_of_locals = locals + 4;
   this->_locals = new Reference[num_of_locals];
+  acyclic(false);
 }
 
-meat::Context::Context(Reference context, std::uint8_t locals)
-  : Object(Class::resolve("Context")), _messenger(context), _result_index(0),
-    done(false) {
+meat::Context::Context(Reference context, std::uint8_t locals,
+                       bool stack_frame)
+  : Object(Class::core(CORE_CONTEXT)), _messenger(std::move(context)),
+    _result_index(0),
+    done(false), _on_stack(stack_frame), _invoke(0), _steps(0) {
+  kind(KIND_CONTEXT);
   num_of_locals = locals + 4;
-  this->_locals = new Reference[num_of_locals];
+  if (_on_stack)
+    this->_locals = frame_alloc(num_of_locals);
+  else
+    this->_locals = new Reference[num_of_locals];
+
+  /*  A context on the frame stack can't be part of a cycle until it's
+   * captured, which promotes it.
+   */
+  acyclic(_on_stack);
 }
 
 meat::Context::Context(Reference cls,
                        Reference context,
                        std::uint8_t locals)
-  : Object(cls), _messenger(context), _result_index(0), done(false) {
+  : Object(std::move(cls)), _messenger(std::move(context)),
+    _result_index(0), done(false), _on_stack(false), _invoke(0),
+    _steps(0) {
+  kind(KIND_CONTEXT);
   num_of_locals = locals + 4;
   this->_locals = new Reference[num_of_locals];
+  acyclic(false);
 }
 
 /***************************
@@ -1020,8 +1931,26 @@ meat::Context::Context(Reference cls,
  ***************************/
 
 meat::Context::~Context() throw() {
-  delete [] _locals;
-  memory::gc::collect();
+  if (_on_stack) frame_release(_locals, num_of_locals);
+  else delete [] _locals;
+}
+
+/**************************
+ * meat::Context::promote *
+ **************************/
+
+void meat::Context::promote() {
+  if (_on_stack) {
+    Reference *frame = _locals;
+
+    _locals = new Reference[num_of_locals];
+    for (std::uint8_t c = 0; c < num_of_locals; ++c)
+      _locals[c] = std::move(frame[c]);
+    _on_stack = false;
+    acyclic(false);
+
+    frame_release(frame, num_of_locals);
+  }
 }
 
 /***********************
@@ -1033,7 +1962,7 @@ meat::Reference meat::Context::self() const {
 }
 
 void meat::Context::self(Reference new_self) {
-  _locals[0] = new_self;
+  _locals[0] = std::move(new_self);
 }
 
 /****************************
@@ -1045,7 +1974,7 @@ meat::Reference meat::Context::messenger() const {
 }
 
 void meat::Context::messenger(Reference context) {
-  _messenger = context;
+  _messenger = std::move(context);
 }
 
 /****************************
@@ -1057,7 +1986,7 @@ meat::Reference meat::Context::parameter(std::uint8_t index) const {
 }
 
 void meat::Context::parameter(std::uint8_t index, Reference value) {
-  _locals[index + 4] = value;
+  _locals[index + 4] = std::move(value);
 }
 
 /************************
@@ -1088,7 +2017,7 @@ void meat::Context::result_index(std::uint8_t local_parent_index) {
  *************************/
 
 void meat::Context::result(Reference value) {
-  _result = value;
+  _result = std::move(value);
   if (_result_index)
     cast<Context>(_messenger).local(_result_index) = _result;
 }
@@ -1097,8 +2026,73 @@ meat::Reference meat::Context::result() const {
   return _result;
 }
 
+/******************************
+ * meat::Context::operator () *
+ ******************************/
+
 meat::Reference meat::Context::operator ()(meat::Reference context) {
-  return pointer(context);
+  _invoke &= ~(INVOKE_WAITING | INVOKE_CATCHES);
+  Reference result = pointer(context);
+
+  // The exception caught is only kept for the one call.
+  if (_invoke & INVOKE_CAUGHT) {
+    _invoke &= ~INVOKE_CAUGHT;
+    _result = meat::Null();
+  }
+  return result;
+}
+
+/*************************
+ * meat::Context::invoke *
+ *************************/
+
+meat::Reference meat::Context::invoke(Reference block, bool catches) {
+  if (block.is_null() or block.is_immediate() or
+      not kind_of<BlockContext>::accepts(block->kind()))
+    throw Exception("Only a BlockContext can be invoked");
+
+  /*  Just like with execute() the block carries on from where it's at, so
+   * the primitive resets the block itself if it's run before.
+   */
+  cast<Context>(block).unfinish();
+
+  _invoke |= INVOKE_WAITING;
+  if (catches) _invoke |= INVOKE_CATCHES;
+  _steps++;
+  return block;
+}
+
+/*************************
+ * meat::Context::caught *
+ *************************/
+
+meat::Reference meat::Context::caught() const {
+  if (_invoke & INVOKE_CAUGHT) return _result;
+  return meat::Null();
+}
+
+/************************
+ * meat::Context::trace *
+ ************************/
+
+void meat::Context::trace(tracer &visit) {
+  Object::trace(visit);
+  for (std::uint8_t c = 0; c < num_of_locals; ++c)
+    visit(_locals[c]);
+  visit(_messenger);
+  visit(_result);
+}
+
+/*************************
+ * meat::Context::unlink *
+ *************************/
+
+void meat::Context::unlink() {
+  Object::unlink();
+  for (std::uint8_t c = 0; c < num_of_locals; ++c)
+    if (not _locals[c].is_weak()) _locals[c] = Null();
+  _messenger = Null();
+  _result = Null();
 }
 
 /******************************************************************************
@@ -1116,8 +2110,12 @@ meat::Reference meat::Context::operator ()(meat::Reference context) {
 
 meat::BlockContext::BlockContext(Reference context, std::uint8_t locals,
                                  std::uint16_t ip)
-  : Context(Class::resolve("BlockContext"), context, locals),
+  : Context(Class::core(CORE_BLOCKCONTEXT), context, locals),
     _origin(context), bc_flags(0), start_ip(ip) {
+  kind(KIND_BLOCKCONTEXT);
+  // The block captures the context it was created in.
+  cast<Context>(context).promote();
+
   flags = meat::Context::BYTECODE;
   this->_ip = ip;
 }
@@ -1129,6 +2127,24 @@ meat::BlockContext::BlockContext(Reference context, std::uint8_t locals,
 meat::BlockContext::~BlockContext() throw() {
 }
 
+/*****************************
+ * meat::BlockContext::trace *
+ *****************************/
+
+void meat::BlockContext::trace(tracer &visit) {
+  Context::trace(visit);
+  visit(_origin);
+}
+
+/******************************
+ * meat::BlockContext::unlink *
+ ******************************/
+
+void meat::BlockContext::unlink() {
+  Context::unlink();
+  _origin = Null();
+}
+
 /*****************************
  * meat::BlockContext::local *
  *****************************/
@@ -1200,42 +2216,59 @@ void meat::BlockContext::reset() {
  * meat::Exception Class
  */
 
+/** Exceptions keep the context they were raised in, so make sure the context
+ * has been promoted from the frame stack.
+ */
+static meat::Reference &capture(meat::Reference &context) {
+  if (not context.is_null() and not context.is_immediate()) {
+    if (meat::kind_of<meat::Context>::accepts(context->kind()))
+      static_cast<meat::Context &>(*context).promote();
+  }
+  return context;
+}
+
 /******************************
  * meat::Exception::Exception *
  ******************************/
 
 meat::Exception::Exception()
-  : Object(Class::resolve("Exception"), 2) {
+  : Object(Class::core(CORE_EXCEPTION), 2) {
+  kind(KIND_EXCEPTION);
   // Empty Exception
 }
 
 meat::Exception::Exception(const Exception &other)
-  : Object(Class::resolve("Exception"), 2) {
+  : Object(Class::core(CORE_EXCEPTION), 2) {
+  kind(KIND_EXCEPTION);
   this->property(0) = other.property(0);
   this->property(1) = other.property(1);
 }
 
 meat::Exception::Exception(Reference cls, std::uint8_t properties)
   : Object(cls, properties) {
+  kind(KIND_EXCEPTION);
   // Empty Exception constructor used for class inheritance.
 }
 
 meat::Exception::Exception(const std::string &message)
-  : Object(Class::resolve("Exception"), 2) {
+  : Object(Class::core(CORE_EXCEPTION), 2) {
+  kind(KIND_EXCEPTION);
   // New exception with a meat Text message.
   this->property(0) = new Text(message);
 }
 
 meat::Exception::Exception(const std::string &message, Reference context)
-  : Object(Class::resolve("Exception"), 2) {
+  : Object(Class::core(CORE_EXCEPTION), 2) {
+  kind(KIND_EXCEPTION);
   this->property(0) = new Text(message);
-  this->property(1) = context;
+  this->property(1) = capture(context);
 }
 
 meat::Exception::Exception(Reference message, Reference context)
-  : Object(Class::resolve("Exception"), 2) {
+  : Object(Class::core(CORE_EXCEPTION), 2) {
+  kind(KIND_EXCEPTION);
   this->property(0) = message;
-  this->property(1) = context;
+  this->property(1) = capture(context);
 }
 
 /*************************
@@ -1264,9 +2297,9 @@ const char* meat::Exception::what() const throw() {
  ****************************************/
 
 meat::BlockParameter::BlockParameter(std::uint8_t offset, Reference block)
-  : Object(Class::resolve("BlockParameter"), 2) {
+  : Object(Class::core(CORE_BLOCKPARAMETER), 2) {
   property(0) = block;
-  property(1) = new Value(offset);
+  property(1) = Integer(offset);
 }
 
 meat::BlockParameter::BlockParameter(Reference cls, std::uint8_t properties)
@@ -1300,22 +2333,26 @@ meat::BlockParameter::set_parameter(Reference value) const {
 
 meat::Value::Value(Reference cls, uint8_t properties)
   : Object(cls, properties), data_type(INTEGER), _integer_value(0) {
+  kind(KIND_VALUE);
   //data.i = 0;
 }
 
 meat::Value::Value(int32_t value)
-  : Object(Class::resolve("Integer")), data_type(INTEGER),
+  : Object(Class::core(CORE_INTEGER)), data_type(INTEGER),
     _integer_value(value) {
+  kind(KIND_VALUE);
   //data.i = value;
 }
 
 meat::Value::Value(double value)
-  : Object(Class::resolve("Number")), data_type(FLOAT) {
+  : Object(Class::core(CORE_NUMBER)), data_type(FLOAT) {
+  kind(KIND_VALUE);
   data.f = value;
 }
 
 meat::Value::Value(bool value)
-  : Object(Class::resolve("Boolean")), data_type(BOOLEAN) {
+  : Object(Class::core(CORE_BOOLEAN)), data_type(BOOLEAN) {
+  kind(KIND_VALUE);
   data.b = value;
 }
 
@@ -1391,19 +2428,23 @@ meat::Value::operator double() const {
  * meat::Text::Text *
  ********************/
 
-meat::Text::Text() : Object(Class::resolve("Text")) {
+meat::Text::Text() : Object(Class::core(CORE_TEXT)) {
+  kind(KIND_TEXT);
 }
 
 meat::Text::Text(const Text &other)
-  : std::string(other), Object(Class::resolve("Text")) {
+  : std::string(other), Object(Class::core(CORE_TEXT)) {
+  kind(KIND_TEXT);
 }
 
 meat::Text::Text(Reference cls, uint8_t properties)
   : Object(cls, properties) {
+  kind(KIND_TEXT);
 }
 
 meat::Text::Text(const std::string &value)
-  : std::string(value), Object(Class::resolve("Text")) {
+  : std::string(value), Object(Class::core(CORE_TEXT)) {
+  kind(KIND_TEXT);
 }
 
 /*************************
@@ -1436,15 +2477,21 @@ void meat::Text::unserialize(data::Archive &store __attribute__((unused)),
  * meat::List::List *
  ********************/
 
-meat::List::List() : Object(Class::resolve("List")) {
+meat::List::List() : Object(Class::core(CORE_LIST)) {
+  kind(KIND_LIST);
+  acyclic(false);
 }
 
 meat::List::List(const List &other)
-  : std::deque<Reference>(other), Object(Class::resolve("List")) {
+  : std::deque<Reference>(other), Object(Class::core(CORE_LIST)) {
+  kind(KIND_LIST);
+  acyclic(false);
 }
 
 meat::List::List(Reference cls, std::uint8_t properties)
   : Object(cls, properties) {
+  kind(KIND_LIST);
+  acyclic(false);
 }
 
 /*************************
@@ -1482,6 +2529,25 @@ void meat::List::unserialize(
   }
 }
 
+/*********************
+ * meat::List::trace *
+ *********************/
+
+void meat::List::trace(tracer &visit) {
+  Object::trace(visit);
+  for (auto &entry: *this)
+    visit(entry);
+}
+
+/**********************
+ * meat::List::unlink *
+ **********************/
+
+void meat::List::unlink() {
+  Object::unlink();
+  clear();
+}
+
 /******************************************************************************
  * Set Class Implemenation
  */
@@ -1490,15 +2556,21 @@ void meat::List::unserialize(
  * meat::Set::Set *
  ******************/
 
-meat::Set::Set() : Object(Class::resolve("Set")) {
+meat::Set::Set() : Object(Class::core(CORE_SET)) {
+  kind(KIND_SET);
+  acyclic(false);
 }
 
 meat::Set::Set(const Set &other)
-  : std::set<Reference, obj_less>(other), Object(Class::resolve("Set")) {
+  : std::set<Reference, obj_less>(other), Object(Class::core(CORE_SET)) {
+  kind(KIND_SET);
+  acyclic(false);
 }
 
 meat::Set::Set(Reference cls, std::uint8_t properties)
   : Object(cls, properties) {
+  kind(KIND_SET);
+  acyclic(false);
 }
 
 /************************
@@ -1537,6 +2609,25 @@ void meat::Set::unserialize(
   }
 }
 
+/********************
+ * meat::Set::trace *
+ ********************/
+
+void meat::Set::trace(tracer &visit) {
+  Object::trace(visit);
+  for (auto &entry: *this)
+    visit(entry);
+}
+
+/*********************
+ * meat::Set::unlink *
+ *********************/
+
+void meat::Set::unlink() {
+  Object::unlink();
+  clear();
+}
+
 /******************************************************************************
  * Index Class Implemenation
  */
@@ -1555,11 +2646,15 @@ bool meat::obj_less::operator()(const Reference &first,
  * meat::Index::Index *
  **********************/
 
-meat::Index::Index() : Object(Class::resolve("Index")) {
+meat::Index::Index() : Object(Class::core(CORE_INDEX)) {
+  kind(KIND_INDEX);
+  acyclic(false);
 }
 
 meat::Index::Index(Reference cls, std::uint8_t properties)
   : Object(cls, properties) {
+  kind(KIND_INDEX);
+  acyclic(false);
 }
 
 /**************************
@@ -1602,6 +2697,27 @@ void meat::Index::unserialize(
   }
 }
 
+/**********************
+ * meat::Index::trace *
+ **********************/
+
+void meat::Index::trace(tracer &visit) {
+  Object::trace(visit);
+  for (auto &entry: *this) {
+    visit(entry.first);
+    visit(entry.second);
+  }
+}
+
+/***********************
+ * meat::Index::unlink *
+ ***********************/
+
+void meat::Index::unlink() {
+  Object::unlink();
+  clear();
+}
+
 /******************************************************************************
  */
 
@@ -1615,9 +2731,12 @@ meat::Reference &__builtin__library() {
  *****************/
 
 void meat::cleanup() {
+  /*  Garbage cycles are collected while the libraries that implement the
+   * objects in them are still loaded.
+   */
+  memory::gc::collect_all();
   __builtin__library() = NULL;
   class_registry().clear();
-  memory::gc::collect_all();
 }
 
 /*****************
@@ -1626,9 +2745,10 @@ void meat::cleanup() {
 
 meat::Reference meat::message(meat::Reference object,
                               std::uint32_t hash_id,
-                              meat::Reference context) {
+                              meat::Reference context,
+                              InlineCache *cache) {
 
-  Reference cls, obj_cls;
+  Reference obj_cls, klass;
   const vtable_entry_t *m_entry = 0;
 
 #ifdef TESTING
@@ -1640,44 +2760,34 @@ meat::Reference meat::message(meat::Reference object,
 #endif
 
   // Resolve the message with the hash_id.
-  if (object->is_class()) {
-    obj_cls = cls = object;
+  bool is_class = meat::is_class(object);
+  if (is_class) obj_cls = object;
+  else obj_cls = type_of(object);
 
-    /*  If the method is inherited then start looking through the parent
-     * classes to find the actual method entry.
-     */
-    while (m_entry == 0 and !cls.is_null()) {
-      m_entry = cast<Class>(cls).class_find(hash_id);
-      if (m_entry == 0) cls = cast<Class>(cls).super();
-    }
+  if (cache) m_entry = cache->find(obj_cls, is_class, klass);
 
-  } else {
-    obj_cls = cls = object->type();
+  if (m_entry == 0) {
+    m_entry = cast<Class>(obj_cls).find_method(hash_id, is_class);
 
-    /*  If the method is inherited then start looking through the parent
-     * classes to find the actual method entry.
-     */
-    while (m_entry == 0 and !cls.is_null()) {
-      m_entry = cast<Class>(cls).find(hash_id);
-      if (m_entry == 0) cls = cast<Class>(cls).super();
-    }
-  }
+    // Raise an error if we couldn't resolve the method name.
+    if (m_entry == 0)
+      throw Exception(std::string("Message ") +
+                      cast<Class>(cast<Context>(context).klass()).lookup(hash_id) +
+                      " is unresolved for class " +
+                      cast<Class>(obj_cls).name(),
+                      context);
 
-  // Raise an error if we couldn't resolve the method name.
-  if (m_entry == 0)
-    throw Exception(std::string("Message ") +
-                    cast<Class>(cast<Context>(context).klass()).lookup(hash_id) +
-                    " is unresolved for class " +
-                    cast<Class>(obj_cls).name(),
-                    context);
+    klass = meat::Class::resolve(m_entry->class_id);
+    if (cache) cache->add(obj_cls, is_class, m_entry, klass);
+  }
 
   // Now create the new context.
-  Context *ctx = new Context(context, m_entry->locals);
+  Context *ctx = new Context(std::move(context), m_entry->locals, true);
   Reference new_context(ctx);
 
   // Populate the mandatory local objects.
-  ctx->_locals[0] = object;                                  // self
-  ctx->_locals[1] = meat::Class::resolve(m_entry->class_id); // class
+  ctx->_locals[0] = std::move(object);                       // self
+  ctx->_locals[1] = std::move(klass);                        // class
   ctx->_locals[3] = meat::Null();                            // null
 
   if ((m_entry->flags & VTM_BYTECODE) == 0) {
@@ -1687,7 +2797,11 @@ meat::Reference meat::message(meat::Reference object,
   } else {
     // Flag for bytecode method.
     ctx->flags = meat::Context::BYTECODE;
-    ctx->_ip = m_entry->method.offset;
+    ctx->_ip = cast<Class>(ctx->_locals[1]).entry(m_entry->method.offset);
+
+    // Hot methods are compiled to native code.
+    if (++m_entry->invocations == JIT::threshold)
+      JIT::compile(cast<Class>(ctx->_locals[1]), ctx->_ip);
   }
 
   // Return the new context.
@@ -1706,50 +2820,40 @@ meat::Reference meat::message(meat::Reference object,
 
 meat::Reference meat::message_super(meat::Reference object,
                                     std::uint32_t hash_id,
-                                    meat::Reference context) {
+                                    meat::Reference context,
+                                    InlineCache *cache) {
 
-  Reference cls, obj_cls;
+  Reference obj_cls, klass;
   const vtable_entry_t *m_entry = 0;
 
   // Resolve the message with the hash_id.
-  if (object->is_class()) {
-    obj_cls = cls = cast<Context>(context).super();
+  bool is_class = meat::is_class(object);
+  obj_cls = cast<Context>(context).super();
 
-    /*  If the method is inherited then start looking through the parent
-     * classes to find the actual method entry.
-     */
-    while (m_entry == 0 and !cls.is_null()) {
-      m_entry = cast<Class>(cls).class_find(hash_id);
-      if (m_entry == 0) cls = cast<Class>(cls).super();
-    }
+  if (cache) m_entry = cache->find(obj_cls, is_class, klass);
 
-  } else {
-    obj_cls = cls = cast<Context>(context).super();
+  if (m_entry == 0) {
+    m_entry = cast<Class>(obj_cls).find_method(hash_id, is_class);
 
-    /*  If the method is inherited then start looking through the parent
-     * classes to find the actual method entry.
-     */
-    while (m_entry == 0 and !cls.is_null()) {
-      m_entry = cast<Class>(cls).find(hash_id);
-      if (m_entry == 0) cls = cast<Class>(cls).super();
-    }
-  }
+    // Raise an error if we couldn't resolve the method name.
+    if (m_entry == 0)
+      throw Exception(std::string("Message ") +
+                      cast<Class>(cast<Context>(context).klass()).lookup(hash_id) +
+                      " is unresolved for class " +
+                      cast<Class>(obj_cls).name(),
+                      context);
 
-  // Raise an error if we couldn't resolve the method name.
-  if (m_entry == 0)
-    throw Exception(std::string("Message ") +
-                    cast<Class>(cast<Context>(context).klass()).lookup(hash_id) +
-                    " is unresolved for class " +
-                    cast<Class>(obj_cls).name(),
-                    context);
+    klass = meat::Class::resolve(m_entry->class_id);
+    if (cache) cache->add(obj_cls, is_class, m_entry, klass);
+  }
 
   // Now create the new context.
-  Context *ctx = new Context(context, m_entry->locals);
+  Context *ctx = new Context(std::move(context), m_entry->locals, true);
   Reference new_context(ctx);
 
   // Populate the mandatory local objects.
-  ctx->_locals[0] = object;                                  // self
-  ctx->_locals[1] = meat::Class::resolve(m_entry->class_id); // class
+  ctx->_locals[0] = std::move(object);                       // self
+  ctx->_locals[1] = std::move(klass);                        // class
   ctx->_locals[3] = meat::Null();                            // null
 
   if ((m_entry->flags & VTM_BYTECODE) == 0) {
@@ -1759,13 +2863,121 @@ meat::Reference meat::message_super(meat::Reference object,
   } else {
     // Flag for bytecode method.
     ctx->flags = meat::Context::BYTECODE;
-    ctx->_ip = m_entry->method.offset;
+    ctx->_ip = cast<Class>(ctx->_locals[1]).entry(m_entry->method.offset);
+
+    // Hot methods are compiled to native code.
+    if (++m_entry->invocations == JIT::threshold)
+      JIT::compile(cast<Class>(ctx->_locals[1]), ctx->_ip);
   }
 
   // Return the new context.
   return new_context;
 }
 
+/***************
+ * only_blocks *
+ ***************/
+
+/** Test if the only references to a captured context, other than the
+ * interpreter's own, are from blocks it created that nothing else holds. Then
+ * nothing can use the context after it's replaced.
+ */
+static bool only_blocks(meat::Reference &context) {
+  meat::Context &ctx = meat::cast<meat::Context>(context);
+  unsigned int holders = 1;
+
+  for (std::uint8_t c = 4; c < ctx.locals(); ++c) {
+    meat::Reference &local = ctx.local(c);
+    if (local.is_null() or local.is_immediate() or
+        local->kind() != meat::KIND_BLOCKCONTEXT)
+      continue;
+
+    meat::BlockContext &block = meat::cast<meat::BlockContext>(local);
+    if (block.origin() == context) {
+      if (local.references() != 1) return false;
+      holders++;
+      if (block.messenger() == context) holders++;
+    }
+  }
+  return (context.references() == holders);
+}
+
+/**********************
+ * meat::message_tail *
+ **********************/
+
+bool meat::message_tail(Reference &context,
+                        const bytecode::instruction_t *in) {
+  Context &ctx = cast<Context>(context);
+
+  /*  A context that's been captured could still be used after it returns, and
+   * the context local itself can't be handed on as it's about to go.
+   */
+  if (in->source == 2 or in->count > TAIL_PARAMETERS) return false;
+  for (std::uint8_t c = 0; c < in->count; c++)
+    if (in->parameter[c] == 2) return false;
+  if (not ctx._on_stack and not only_blocks(context)) return false;
+
+  // Only sends that already resolved to a bytecode method are replaced.
+  Reference self = ctx._locals[in->source];
+  if (self.is_null()) return false;
+
+  bool is_class = meat::is_class(self);
+  Reference obj_cls = (is_class ? self : type_of(self));
+  Reference klass;
+  const vtable_entry_t *m_entry = in->cache->find(obj_cls, is_class, klass);
+  if (m_entry == nullptr or (m_entry->flags & VTM_BYTECODE) == 0)
+    return false;
+
+  Reference args[TAIL_PARAMETERS];
+  for (std::uint8_t c = 0; c < in->count; c++)
+    args[c] = ctx._locals[in->parameter[c]];
+
+  /*  The new context answers to our messenger in our place. We're released
+   * first so the new context's locals take over our frame.
+   */
+  Reference messenger = std::move(ctx._messenger);
+  std::uint8_t result_index = ctx._result_index;
+  ctx._messenger = meat::Null();
+  ctx.finish();
+
+  // Releasing the locals also releases our blocks, which hold on to us.
+  for (std::uint8_t c = 0; c < ctx.num_of_locals; c++)
+    ctx._locals[c] = Reference();
+  context = Reference();
+
+  Context *callee = new Context(std::move(messenger), m_entry->locals, true);
+  context = Reference(callee);
+
+  callee->_locals[0] = std::move(self);                     // self
+  callee->_locals[1] = std::move(klass);                    // class
+  callee->_locals[3] = meat::Null();                        // null
+  for (std::uint8_t c = 0; c < in->count; c++)
+    callee->parameter(c, std::move(args[c]));
+  callee->_result_index = result_index;
+  callee->_result = meat::Null();
+
+  callee->flags = meat::Context::BYTECODE;
+  callee->_ip = cast<Class>(callee->_locals[1]).entry(m_entry->method.offset);
+
+  // Hot methods are compiled to native code.
+  if (++m_entry->invocations == JIT::threshold)
+    JIT::compile(cast<Class>(callee->_locals[1]), callee->_ip);
+
+  // This takes the place of a return, so it's a safe point too.
+  if (memory::gc::collection_due()) memory::gc::collect();
+
+  return true;
+}
+
+/**********************
+ * meat::lookup_stats *
+ **********************/
+
+meat::lookup_stats_t meat::lookup_stats() {
+  return lookup_statistics();
+}
+
 #ifdef DEBUG
 std::ostream &meat::operator <<(std::ostream &out, Class &cls) {
   return (out << "CLASS<" << cls.name() << ">");
@@ -1796,27 +3008,11 @@ meat::CompilerInterface *meat::compiler() {
  *****************/
 
 meat::Reference meat::Boolean(bool value) {
-  static Reference true_object;
-  static Reference false_object;
-
-  if (true_object.is_null()) {
-    true_object = Class::resolve("Boolean")->property(0);
-  }
-  if (false_object.is_null()) {
-    false_object = Class::resolve("Boolean")->property(1);
-  }
-
-  return (value ? true_object : false_object);
+  return Class::core(CORE_BOOLEAN)->property(value ? 0 : 1);
 }
 
 bool meat::Boolean(meat::Reference value) {
-  static Reference true_object;
-
-  if (true_object.is_null()) {
-    true_object = Class::resolve("Boolean")->property(0);
-  }
-
-  return (value == true_object);
+  return (value == Class::core(CORE_BOOLEAN)->property(0));
 }
 
 /**************
@@ -1824,23 +3020,15 @@ bool meat::Boolean(meat::Reference value) {
  **************/
 
 meat::Reference meat::Null() {
-  static Reference null_object;
-
-  if (null_object.is_null()) {
-    /*  We need to be a little more hands on here. As the initial object and
-     * Class class objects are created they need some kind of null value before
-     * the Null object and class are created. The normal way will cause
-     * Exceptions before there is even a meat Exception class. So if
-     * initially someone wants a Null object before there is a Null object we
-     * just return a null reference.
-     */
-    std::uint32_t hash_id = hash("Null");
-    class_registry_t &classes = class_registry();
-
-    if (classes.find(hash_id) != classes.end()) {
-      null_object = classes[hash_id]->property(0);
-    }
-  }
+  /*  We need to be a little more hands on here. As the initial object and
+   * Class class objects are created they need some kind of null value before
+   * the Null object and class are created. The normal way will cause
+   * Exceptions before there is even a meat Exception class. So if
+   * initially someone wants a Null object before there is a Null object we
+   * just return a null reference.
+   */
+  Reference &null_cls = core_classes()[CORE_NULL].cls;
 
-  return null_object;
+  if (null_cls.is_null()) return Reference();
+  return null_cls->property(0);
 }
@@ -19,42 +19,552 @@
 
 #include <meat/memory.h>
 
-typedef struct memory_s {
-  std::size_t size;
-  time_t collected_time;
-} memory_t;
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#endif
 
 std::size_t memory::gc::limit = 5 * 1024 * 1024; // 5M
 time_t memory::gc::collection_age = 60; // 1 minute
-std::multimap<std::size_t, void *> memory::gc::free_memory;
-std::size_t memory::gc::free_size = 0;
+std::size_t memory::gc::collection_interval = 65536;
+std::size_t memory::gc::collection_budget = 16;
+
+/******************************************************************************
+ * Slabs
+ *
+ *  Every slab is SLAB_SIZE bytes aligned to SLAB_SIZE, so the slab a block
+ * belongs to is found by masking the block's address. The slab header is at
+ * the start of the slab followed by the blocks. The size classes go up by
+ * GRANULE bytes to SMALL_BLOCK, then by four classes between each power of 2
+ * up to MAX_BLOCK, so objects with a lot of trailing properties still come
+ * from a slab. Objects too large for the size classes get a slab of their
+ * own, sized to fit.
+ *
+ *  Every thread allocates from a heap of its own, so the common paths take
+ * no locks. A slab belongs to the heap that allocated it. A block recycled
+ * by another thread is pushed onto the owning heap's remote queue, and the
+ * owner recycles it later. Empty slabs the heaps give back go to a central
+ * pool, that any heap can take a slab from, behind the only lock.
+ *
+ *  Empty slabs are also kept in the order they were emptied, so a
+ * collection step only has to look at the oldest of them.
+ */
+
+#define SLAB_SIZE    (64 * 1024)
+#define GRANULE      16
+#define SMALL_CLASSES 32 // Blocks from 16 to 512 bytes.
+#define SMALL_BLOCK  (GRANULE * SMALL_CLASSES)
+#define SIZE_CLASSES (SMALL_CLASSES + 16) // Then up to 8k bytes.
+#define MAX_BLOCK    8192
+#define LARGE_OBJECT SIZE_CLASSES
+#define PUBLISH      SLAB_SIZE // Bytes a heap counts before publishing them.
+
+struct _heap_s;
+
+/*  The statistics are only changed by the thread that owns the heap, but any
+ * thread may read them. They're relaxed atomics so the reads are never torn,
+ * and since there's only one writer they're updated without a locked
+ * instruction.
+ */
+typedef std::atomic<std::size_t> counter_t;
+
+static inline void counter_add(counter_t &counter, std::size_t value) {
+  counter.store(counter.load(std::memory_order_relaxed) + value,
+                std::memory_order_relaxed);
+}
+
+static inline void counter_sub(counter_t &counter, std::size_t value) {
+  counter.store(counter.load(std::memory_order_relaxed) - value,
+                std::memory_order_relaxed);
+}
+
+typedef struct _slab_s {
+  struct _slab_s *prev;
+  struct _slab_s *next;   // The size class's slabs with free blocks.
+  std::size_t size;       // The size of the slab's pages.
+  std::uint32_t size_class;
+  std::uint32_t used;     // The number of blocks allocated.
+  std::uint32_t capacity; // The number of blocks the slab holds.
+  unsigned char *bump;    // The first block that has never been allocated.
+  void *free_list;        // Blocks that have been recycled.
+  time_t emptied;         // When the last block was recycled.
+  struct _slab_s *older;  // The empty slabs.
+  struct _slab_s *newer;
+  struct _heap_s *owner;
+} slab_t;
+
+#define SLAB_HEADER \
+  ((sizeof(slab_t) + GRANULE - 1) & ~(std::size_t)(GRANULE - 1))
+
+typedef struct _slab_class_s {
+  slab_t *available;      // Slabs with free blocks.
+  counter_t slabs;
+  counter_t used;
+} slab_class_t;
+
+typedef struct _heap_s {
+  slab_class_t classes[SIZE_CLASSES];
+  counter_t empty;        // Bytes held by slabs with no blocks allocated.
+  slab_t *oldest;         // The empty slabs, oldest first.
+  slab_t *newest;
+  std::size_t allocations; // Allocations since the last collection step.
+  std::atomic<void *> remote; // Blocks recycled by other threads.
+
+  struct _heap_s *next_heap;
+  bool abandoned;         // The heap's thread has exited.
+
+  // Statistics
+  counter_t allocated;    // Blocks ever allocated.
+  counter_t reused;       // Allocations from recycled blocks.
+  counter_t recycled;     // Blocks ever recycled.
+  counter_t bytes;        // Bytes in allocated blocks and large objects.
+  counter_t large;        // Large objects allocated.
+  counter_t large_bytes;
+  std::size_t unpublished; // Bytes not yet added to the pool's bytes.
+} heap_t;
+
+typedef struct _pool_s {
+  std::mutex lock;
+  slab_t *slabs;          // Empty slabs, linked by next.
+  std::size_t count;
+  heap_t *heaps;          // Every heap, including the abandoned ones.
+
+  /*  The bytes allocated by every heap, each heap adds to it once its own
+   * count has changed by PUBLISH bytes. The peak is taken from it, so it's
+   * the peak of the whole process give or take PUBLISH bytes a heap.
+   */
+  std::atomic<std::size_t> bytes;
+  std::atomic<std::size_t> peak_bytes;
+} pool_t;
+
+static pool_t &pool() {
+  // Never destroyed, threads may still be recycling during exit.
+  static pool_t *pool = new pool_t();
+
+  return *pool;
+}
+
+/*  Abandons the thread's heap when the thread exits, so another thread can
+ * adopt it along with any blocks still allocated from it.
+ */
+typedef struct _heap_guard_s {
+  heap_t *heap;
+  ~_heap_guard_s();
+} heap_guard_t;
+
+#if defined(__GNUC__) and not defined(_WIN32)
+static __thread heap_t *local __attribute__((tls_model("initial-exec")));
+static __thread bool exited __attribute__((tls_model("initial-exec")));
+#else
+static thread_local heap_t *local = nullptr;
+static thread_local bool exited = false;
+#endif
+static thread_local heap_guard_t guard = {nullptr};
+
+static heap_t *heap_acquire();
+static void heap_abandon(heap_t *h);
+
+/*  The heap the thread is using for a call into the allocator. A thread that
+ * has already abandoned its heap while exiting borrows one for just the call,
+ * and the blocks it recycles go to their heaps' remote queues.
+ */
+typedef struct _heap_use_s {
+  heap_t &heap;
+  _heap_use_s() : heap(local ? *local : *heap_acquire()) {}
+  ~_heap_use_s() { if (&heap != local) heap_abandon(&heap); }
+} heap_use_t;
+
+static inline slab_t *slab_of(void *ptr) {
+  return (slab_t *)((std::uintptr_t)ptr & ~(std::uintptr_t)(SLAB_SIZE - 1));
+}
+
+/** The size of the blocks in a size class.
+ */
+static inline std::size_t class_size(std::size_t index) {
+  if (index < SMALL_CLASSES) return (index + 1) * GRANULE;
+  std::size_t octave = (index - SMALL_CLASSES) / 4;
+  return ((SMALL_BLOCK << octave) +
+          ((SMALL_BLOCK / 4) << octave) * ((index - SMALL_CLASSES) % 4 + 1));
+}
+
+/** The smallest size class that holds size bytes.
+ */
+static inline std::size_t class_index(std::size_t size) {
+  if (size <= SMALL_BLOCK) return (size - 1) / GRANULE;
+  // The octave above SMALL_BLOCK (512 << 1 is 1 << 10), then its quarter.
+  std::size_t octave = 0;
+  while ((size - 1) >> (octave + 10)) ++octave;
+  return (SMALL_CLASSES + octave * 4 + (((size - 1) >> (octave + 7)) & 3));
+}
+
+static inline std::uint32_t slab_capacity(std::size_t index) {
+  return (SLAB_SIZE - SLAB_HEADER) / class_size(index);
+}
+
+/***********
+ * publish *
+ ***********/
+
+static void publish(heap_t &h) {
+  pool_t &p = pool();
+  std::size_t bytes =
+    p.bytes.fetch_add(h.unpublished, std::memory_order_relaxed) +
+    h.unpublished;
+  h.unpublished = 0;
+
+  std::size_t peak = p.peak_bytes.load(std::memory_order_relaxed);
+  while (bytes > peak and
+         not p.peak_bytes.compare_exchange_weak(peak, bytes,
+                                                std::memory_order_relaxed))
+    ;
+}
+
+static inline void count_bytes(heap_t &h, std::size_t bytes, bool alloc) {
+  /*  The unpublished bytes wrap around when more are recycled than
+   * allocated, adding them to the pool's bytes still comes out right.
+   */
+  if (alloc) {
+    counter_add(h.bytes, bytes);
+    h.unpublished += bytes;
+  } else {
+    counter_sub(h.bytes, bytes);
+    h.unpublished -= bytes;
+  }
+  // Publish once more than PUBLISH bytes either way have been counted.
+  if (h.unpublished + PUBLISH > 2 * PUBLISH) publish(h);
+}
+
+static inline void count_alloc(heap_t &h, std::size_t bytes) {
+  counter_add(h.allocated, 1);
+  count_bytes(h, bytes, true);
+}
+
+/**************
+ * page_alloc *
+ **************/
+
+static void *page_alloc(std::size_t size) {
+#if defined(_WIN32)
+  // Windows already aligns allocations to 64k.
+  return VirtualAlloc(NULL, size, MEM_COMMIT | MEM_RESERVE, PAGE_READWRITE);
+#else
+  /* Map enough to align the slab to SLAB_SIZE then give back the pages on
+   * either side of it.
+   */
+  std::size_t span = size + SLAB_SIZE;
+  void *map = mmap(NULL, span, PROT_READ | PROT_WRITE,
+                   MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if (map == MAP_FAILED) return nullptr;
+
+  std::uintptr_t base = (std::uintptr_t)map;
+  std::uintptr_t start =
+    (base + SLAB_SIZE - 1) & ~(std::uintptr_t)(SLAB_SIZE - 1);
+  if (start > base) munmap(map, start - base);
+  if (base + span > start + size)
+    munmap((void *)(start + size), base + span - (start + size));
+  return (void *)start;
+#endif
+}
+
+/*************
+ * page_free *
+ *************/
+
+static void page_free(void *pages, std::size_t size) {
+#if defined(_WIN32)
+  (void)size;
+  VirtualFree(pages, 0, MEM_RELEASE);
+#else
+  munmap(pages, size);
+#endif
+}
+
+/*************
+ * pool_give *
+ *************/
+
+static void pool_give(slab_t *slab) {
+  // The pool keeps no more than limit bytes of slabs.
+  pool_t &p = pool();
+  {
+    std::lock_guard<std::mutex> hold(p.lock);
+    if ((p.count + 1) * SLAB_SIZE <= memory::gc::limit) {
+      slab->next = p.slabs;
+      p.slabs = slab;
+      p.count++;
+      return;
+    }
+  }
+  page_free(slab, SLAB_SIZE);
+}
+
+/*************
+ * pool_take *
+ *************/
+
+static slab_t *pool_take() {
+  pool_t &p = pool();
+  std::lock_guard<std::mutex> hold(p.lock);
+  slab_t *slab = p.slabs;
+  if (slab) {
+    p.slabs = slab->next;
+    p.count--;
+  }
+  return slab;
+}
+
+/*************
+ * slab_link *
+ *************/
+
+static inline void slab_link(slab_class_t &cls, slab_t *slab) {
+  slab->prev = nullptr;
+  slab->next = cls.available;
+  if (cls.available) cls.available->prev = slab;
+  cls.available = slab;
+}
+
+/***************
+ * slab_unlink *
+ ***************/
+
+static inline void slab_unlink(slab_class_t &cls, slab_t *slab) {
+  if (slab->prev) slab->prev->next = slab->next;
+  else cls.available = slab->next;
+  if (slab->next) slab->next->prev = slab->prev;
+  slab->prev = slab->next = nullptr;
+}
+
+/**************
+ * empty_link *
+ **************/
+
+static inline void empty_link(heap_t &h, slab_t *slab) {
+  time(&(slab->emptied));
+  slab->older = h.newest;
+  slab->newer = nullptr;
+  if (h.newest) h.newest->newer = slab;
+  else h.oldest = slab;
+  h.newest = slab;
+  counter_add(h.empty, SLAB_SIZE);
+}
+
+/****************
+ * empty_unlink *
+ ****************/
+
+static inline void empty_unlink(heap_t &h, slab_t *slab) {
+  if (slab->older) slab->older->newer = slab->newer;
+  else h.oldest = slab->newer;
+  if (slab->newer) slab->newer->older = slab->older;
+  else h.newest = slab->older;
+  slab->older = slab->newer = nullptr;
+  counter_sub(h.empty, SLAB_SIZE);
+}
+
+/************
+ * slab_new *
+ ************/
+
+static slab_t *slab_new(heap_t &h, std::size_t index) {
+  slab_t *slab = pool_take();
+  if (slab == nullptr) {
+    slab = (slab_t *)page_alloc(SLAB_SIZE);
+    if (slab == nullptr) throw std::bad_alloc();
+  }
+
+  slab->size = SLAB_SIZE;
+  slab->size_class = index;
+  slab->used = 0;
+  slab->capacity = slab_capacity(index);
+  slab->bump = (unsigned char *)slab + SLAB_HEADER;
+  slab->free_list = nullptr;
+  slab->owner = &h;
+
+  slab_class_t &cls = h.classes[index];
+  slab_link(cls, slab);
+  counter_add(cls.slabs, 1);
+  empty_link(h, slab);
+  return slab;
+}
+
+/**************
+ * slab_empty *
+ **************/
+
+static void slab_empty(heap_t &h, slab_t *slab) {
+  // Takes an empty slab away from its heap.
+  slab_class_t &cls = h.classes[slab->size_class];
+  slab_unlink(cls, slab);
+  empty_unlink(h, slab);
+  counter_sub(cls.slabs, 1);
+}
+
+/*****************
+ * local_recycle *
+ *****************/
+
+static void local_recycle(heap_t &h, void *ptr) {
+  counter_add(h.recycled, 1);
+
+  slab_t *slab = slab_of(ptr);
+  if (slab->size_class == LARGE_OBJECT) {
+    counter_sub(h.large, 1);
+    counter_sub(h.large_bytes, slab->size);
+    count_bytes(h, slab->size, false);
+    page_free(slab, slab->size);
+    return;
+  }
+
+  count_bytes(h, class_size(slab->size_class), false);
+  slab_class_t &cls = h.classes[slab->size_class];
+  *(void **)ptr = slab->free_list;
+  slab->free_list = ptr;
+  if (slab->used-- == slab->capacity) slab_link(cls, slab);
+  counter_sub(cls.used, 1);
+
+  // An empty slab is kept for reuse until a collection step gives it back.
+  if (slab->used == 0) empty_link(h, slab);
+}
+
+/****************
+ * remote_drain *
+ ****************/
+
+static bool remote_drain(heap_t &h) {
+  // Recycle the blocks other threads recycled for this heap.
+  void *block = h.remote.exchange(nullptr, std::memory_order_acquire);
+  if (block == nullptr) return false;
+
+  while (block) {
+    void *next = *(void **)block;
+    local_recycle(h, block);
+    block = next;
+  }
+  return true;
+}
+
+/****************
+ * heap_acquire *
+ ****************/
+
+static heap_t *heap_acquire() {
+  // Adopt an abandoned heap, otherwise start a new one.
+  pool_t &p = pool();
+  heap_t *h = nullptr;
+  {
+    std::lock_guard<std::mutex> hold(p.lock);
+    for (heap_t *each = p.heaps; each; each = each->next_heap) {
+      if (each->abandoned) {
+        each->abandoned = false;
+        h = each;
+        break;
+      }
+    }
+    if (h == nullptr) {
+      h = new heap_t();
+      h->next_heap = p.heaps;
+      p.heaps = h;
+    }
+  }
+
+  // The guard has already been destroyed on a thread that's exiting.
+  if (not exited) {
+    local = h;
+    guard.heap = h;
+  }
+  return h;
+}
+
+/****************
+ * heap_abandon *
+ ****************/
+
+static void heap_abandon(heap_t *h) {
+  std::lock_guard<std::mutex> hold(pool().lock);
+  h->abandoned = true;
+}
+
+/*********************************
+ * _heap_guard_s::~_heap_guard_s *
+ *********************************/
+
+_heap_guard_s::~_heap_guard_s() {
+  if (heap == nullptr) return;
+
+  // The heap's empty slabs can be used by the other threads right away.
+  while (heap->oldest) {
+    slab_t *slab = heap->oldest;
+    slab_empty(*heap, slab);
+    pool_give(slab);
+  }
+
+  /*  Anything the thread recycles from now on goes to the heap's remote
+   * queue, for whichever thread adopts it.
+   */
+  local = nullptr;
+  exited = true;
+  heap_abandon(heap);
+}
 
 /*********************
  * memory::gc::alloc *
  *********************/
 
-#include <iostream>
-
 void *memory::gc::alloc(std::size_t size) {
-  unsigned char *res = 0;
+  if (size == 0) size = 1;
+  heap_use_t use;
+  heap_t &h = use.heap;
 
-  /* To help further speed up allocation, we don't just try to find the
-   * exact size of memory requested. Instead we use lower_bound to find a
-   * memory block that would fit the request and make sure it's no bigger
-   * than the requested size by 50 bytes.
-   */
-  auto it = free_memory.lower_bound(size);
-  if (it != free_memory.end() and (it->first - size) < 50) {
-    res = (unsigned char *)(it->second);
-    free_memory.erase(it);
-    free_size -= ((memory_t*)res)->size;
+  if (size > MAX_BLOCK) {
+    // Large objects get pages of their own.
+    std::size_t pages = (SLAB_HEADER + size + 4095) & ~(std::size_t)4095;
+    slab_t *slab = (slab_t *)page_alloc(pages);
+    if (slab == nullptr) throw std::bad_alloc();
+    slab->size = pages;
+    slab->size_class = LARGE_OBJECT;
+    slab->owner = &h;
+
+    counter_add(h.large, 1);
+    counter_add(h.large_bytes, pages);
+    count_alloc(h, pages);
+    return (unsigned char *)slab + SLAB_HEADER;
+  }
+
+  h.allocations++;
+
+  std::size_t index = class_index(size);
+  slab_class_t &cls = h.classes[index];
+  slab_t *slab = cls.available;
+  if (slab == nullptr) {
+    // Blocks other threads gave back may free up a slab.
+    if (remote_drain(h)) slab = cls.available;
+    if (slab == nullptr) slab = slab_new(h, index);
+  }
+
+  // Reuse a recycled block first, otherwise bump into the untouched blocks.
+  void *block = slab->free_list;
+  if (block) {
+    slab->free_list = *(void **)block;
+    counter_add(h.reused, 1);
   } else {
-    // An appropriate block couldn't be found so get more from the system.
-    res = (unsigned char *)::operator new(size + sizeof(memory_t));
-    ((memory_t *)(res))->size = size;
+    block = slab->bump;
+    slab->bump += class_size(index);
   }
 
-  return (res + sizeof(memory_t));
+  if (slab->used++ == 0) empty_unlink(h, slab);
+  if (slab->used == slab->capacity) slab_unlink(cls, slab);
+  counter_add(cls.used, 1);
+  count_alloc(h, class_size(index));
+
+  return block;
 }
 
 /***********************
@@ -62,36 +572,86 @@ void *memory::gc::alloc(std::size_t size) {
  ***********************/
 
 void memory::gc::recycle(void *ptr) throw() {
-  /* Add the memory block to the free list according to it's size and update
-   * it's timestamp.
-   */
-  memory_t *mptr = (memory_t *)((unsigned char *)ptr - sizeof(memory_t));
-  if (mptr->size + free_size < limit) {
-    free_memory.insert(std::make_pair(mptr->size, mptr));
-    free_size += mptr->size;
-    time(&(mptr->collected_time));
+  if (ptr == nullptr) return;
+
+  heap_t *owner = slab_of(ptr)->owner;
+  if (owner == local) {
+    local_recycle(*owner, ptr);
   } else {
-    ::operator delete(mptr);
+    // Blocks from another thread's heap are queued for that thread.
+    void *head = owner->remote.load(std::memory_order_relaxed);
+    do {
+      *(void **)ptr = head;
+    } while (not owner->remote.compare_exchange_weak(
+               head, ptr, std::memory_order_release,
+               std::memory_order_relaxed));
   }
 }
 
+/*********************
+ * memory::gc::block *
+ *********************/
+
+void *memory::gc::block(const void *ptr) noexcept {
+  slab_t *slab = slab_of((void *)ptr);
+  unsigned char *blocks = (unsigned char *)slab + SLAB_HEADER;
+  if (slab->size_class == LARGE_OBJECT) return blocks;
+
+  std::size_t size = class_size(slab->size_class);
+  return blocks + (((unsigned char *)ptr - blocks) / size) * size;
+}
+
+/**************************
+ * memory::gc::block_size *
+ **************************/
+
+std::size_t memory::gc::block_size(const void *ptr) noexcept {
+  slab_t *slab = slab_of((void *)ptr);
+  if (slab->size_class == LARGE_OBJECT) return slab->size - SLAB_HEADER;
+  return class_size(slab->size_class);
+}
+
+/******************************
+ * memory::gc::collection_due *
+ ******************************/
+
+bool memory::gc::collection_due(void) {
+  heap_use_t use;
+  heap_t &h = use.heap;
+  return ((collection_interval and h.allocations >= collection_interval) or
+          h.empty.load(std::memory_order_relaxed) > limit or
+          h.remote.load(std::memory_order_relaxed) != nullptr or
+          cycles_due());
+}
+
 /***********************
  * memory::gc::collect *
  ***********************/
 
 void memory::gc::collect(void) {
-  /* Find blocks of memory that are older than the collection_age and
-   * actually give them back to the system.
+  heap_use_t use;
+  heap_t &h = use.heap;
+  h.allocations = 0;
+
+  remote_drain(h);
+  collect_cycles();
+
+  /*  Give back the oldest empty slabs while there's too many of them or
+   * they've been empty longer than the collection_age. Slabs that are too
+   * old go back to the system, the others to the central pool.
    */
-  memory_t *mptr = NULL;
-  auto it = free_memory.begin();
-  while (it != free_memory.end()) {
-    mptr = (memory_t *)it->second;
-    if (mptr->collected_time - time(NULL) >= collection_age) {
-      ::operator delete(it->second);
-      it = free_memory.erase(it);
-    } else {
-      ++it;
+  if (h.oldest) {
+    time_t now = time(NULL);
+    for (std::size_t count = 0;
+         h.oldest and (collection_budget == 0 or count < collection_budget);
+         ++count) {
+      slab_t *slab = h.oldest;
+      bool expired = (now - slab->emptied >= collection_age);
+      if (h.empty.load(std::memory_order_relaxed) <= limit and not expired)
+        break;
+      slab_empty(h, slab);
+      if (expired) page_free(slab, SLAB_SIZE);
+      else pool_give(slab);
     }
   }
 }
@@ -101,9 +661,369 @@ void memory::gc::collect(void) {
  ***************************/
 
 void memory::gc::collect_all(void) {
-  for (auto &block: free_memory)
-    ::operator delete(block.second);
-  free_memory.clear();
+  std::size_t budget = cycle_budget;
+  cycle_budget = 0;
+  while (collect_cycles()) ;
+  cycle_budget = budget;
+
+  heap_use_t use;
+  heap_t &h = use.heap;
+  remote_drain(h);
+  while (h.oldest) {
+    slab_t *slab = h.oldest;
+    slab_empty(h, slab);
+    page_free(slab, SLAB_SIZE);
+  }
+  h.allocations = 0;
+
+  while (slab_t *slab = pool_take()) page_free(slab, SLAB_SIZE);
+}
+
+/****************************
+ * memory::gc::size_classes *
+ ****************************/
+
+std::size_t memory::gc::size_classes(void) {
+  return SIZE_CLASSES;
+}
+
+/*************************
+ * memory::gc::occupancy *
+ *************************/
+
+memory::gc::size_class_t memory::gc::occupancy(std::size_t index) {
+  size_class_t result = {0, 0, 0, 0};
+
+  if (index < SIZE_CLASSES) {
+    pool_t &p = pool();
+    std::lock_guard<std::mutex> hold(p.lock);
+    result.block_size = class_size(index);
+    for (heap_t *h = p.heaps; h; h = h->next_heap) {
+      result.slabs +=
+        h->classes[index].slabs.load(std::memory_order_relaxed);
+      result.used += h->classes[index].used.load(std::memory_order_relaxed);
+    }
+    result.blocks = result.slabs * slab_capacity(index);
+  }
+  return result;
+}
+
+/*********************
+ * memory::gc::stats *
+ *********************/
+
+memory::gc::stats_t memory::gc::stats(void) {
+  /*  The statistics are summed over every thread's heap, the other threads'
+   * counts may be a little behind. The peak is the process wide peak the
+   * heaps have published.
+   */
+  stats_t result = {0, 0, 0, 0, 0, 0, 0, 0, 0};
+  std::size_t large_bytes = 0;
+
+  pool_t &p = pool();
+  std::lock_guard<std::mutex> hold(p.lock);
+  for (heap_t *h = p.heaps; h; h = h->next_heap) {
+    result.allocations += h->allocated.load(std::memory_order_relaxed);
+    result.reused += h->reused.load(std::memory_order_relaxed);
+    result.recycled += h->recycled.load(std::memory_order_relaxed);
+    result.bytes += h->bytes.load(std::memory_order_relaxed);
+    result.large_objects += h->large.load(std::memory_order_relaxed);
+    large_bytes += h->large_bytes.load(std::memory_order_relaxed);
+    for (std::size_t index = 0; index < SIZE_CLASSES; ++index)
+      result.slabs += h->classes[index].slabs.load(std::memory_order_relaxed);
+    result.empty_bytes += h->empty.load(std::memory_order_relaxed);
+  }
+  result.peak_bytes = p.peak_bytes.load(std::memory_order_relaxed);
+  if (result.bytes > result.peak_bytes) result.peak_bytes = result.bytes;
+  result.slabs += p.count;
+  result.slab_bytes = result.slabs * SLAB_SIZE + large_bytes;
+  result.empty_bytes += p.count * SLAB_SIZE;
+  return result;
+}
+
+/******************************************************************************
+ * Cycle Collector
+ *
+ *  Possible roots are buffered with a weak reference to them, so a buffered
+ * object that's destroyed keeps its block until the buffer is examined.
+ */
+
+std::size_t memory::gc::cycle_budget = 2048;
+std::size_t memory::gc::cycle_threshold = 2048;
+
+typedef struct _cycles_s {
+  std::vector<memory::recyclable::counts_t *> roots;
+  std::vector<memory::collectable *> stack;
+  std::vector<memory::collectable *> garbage;
+  bool collecting;
+  memory::gc::cycle_stats_t stats;
+} cycles_t;
+
+static cycles_t &cycles() {
+  static cycles_t cycles = {{}, {}, {}, false, {0, 0, 0, 0, 0}};
+
+  return cycles;
+}
+
+/*****************************
+ * memory::gc::possible_root *
+ *****************************/
+
+void memory::gc::possible_root(collectable *obj) {
+  recyclable::counts_t *cnt = obj->counts();
+  cnt->color = PURPLE;
+  if (not cnt->buffered) {
+    cnt->buffered = 1;
+    recyclable::weak(cnt);
+    cycles().roots.push_back(cnt);
+  }
+}
+
+/***************************
+ * memory::gc::forget_root *
+ ***************************/
+
+void memory::gc::forget_root(collectable *obj) {
+  /*  Objects are usually destroyed in the reverse order they were buffered,
+   * so dropping the newest root right away lets its block be reused now
+   * instead of after the next collection.
+   */
+  cycles_t &state = cycles();
+  recyclable::counts_t *cnt = obj->counts();
+  if (not state.roots.empty() and state.roots.back() == cnt) {
+    state.roots.pop_back();
+    cnt->buffered = 0;
+    recyclable::unweak(cnt);
+  }
+}
+
+/*************************
+ * memory::gc::mark_gray *
+ *************************/
+
+void memory::gc::mark_gray(collectable *obj) {
+  /*  Gray objects have the references they hold taken away from the objects
+   * they reference. Whatever is left is referenced from outside of them.
+   */
+  class marker : public collectable::tracer {
+  public:
+    marker(std::vector<collectable *> &stack) : stack(stack) {}
+
+  protected:
+    virtual void visit(collectable *obj) {
+      obj->counts()->refs--;
+      if (obj->counts()->color != GRAY) {
+        obj->counts()->color = GRAY;
+        stack.push_back(obj);
+      }
+    }
+
+  private:
+    std::vector<collectable *> &stack;
+  };
+
+  if (obj->counts()->color == GRAY) return;
+
+  cycles_t &state = cycles();
+  marker visit(state.stack);
+  obj->counts()->color = GRAY;
+  state.stack.push_back(obj);
+  while (not state.stack.empty()) {
+    collectable *gray = state.stack.back();
+    state.stack.pop_back();
+    gray->trace(visit);
+    state.stats.traced++;
+  }
+}
+
+/********************
+ * memory::gc::scan *
+ ********************/
+
+void memory::gc::scan(collectable *obj) {
+  /*  Gray objects still referenced from outside are in use, along with
+   * everything they reference. The rest are garbage unless something in use
+   * references them.
+   */
+  class scanner : public collectable::tracer {
+  public:
+    scanner(std::vector<collectable *> &stack) : stack(stack) {}
+
+  protected:
+    virtual void visit(collectable *obj) { stack.push_back(obj); }
+
+  private:
+    std::vector<collectable *> &stack;
+  };
+
+  std::vector<collectable *> stack;
+  scanner visit(stack);
+  stack.push_back(obj);
+  while (not stack.empty()) {
+    collectable *gray = stack.back();
+    stack.pop_back();
+    if (gray->counts()->color == GRAY) {
+      if (gray->counts()->refs > 0) {
+        scan_black(gray);
+      } else {
+        gray->counts()->color = WHITE;
+        gray->trace(visit);
+      }
+    }
+  }
+}
+
+/**************************
+ * memory::gc::scan_black *
+ **************************/
+
+void memory::gc::scan_black(collectable *obj) {
+  // Give back the references taken by mark_gray.
+  class restorer : public collectable::tracer {
+  public:
+    restorer(std::vector<collectable *> &stack) : stack(stack) {}
+
+  protected:
+    virtual void visit(collectable *obj) {
+      obj->counts()->refs++;
+      if (obj->counts()->color != BLACK) {
+        obj->counts()->color = BLACK;
+        stack.push_back(obj);
+      }
+    }
+
+  private:
+    std::vector<collectable *> &stack;
+  };
+
+  cycles_t &state = cycles();
+  restorer visit(state.stack);
+  obj->counts()->color = BLACK;
+  state.stack.push_back(obj);
+  while (not state.stack.empty()) {
+    collectable *black = state.stack.back();
+    state.stack.pop_back();
+    black->trace(visit);
+  }
+}
+
+/*****************************
+ * memory::gc::collect_white *
+ *****************************/
+
+void memory::gc::collect_white(collectable *obj) {
+  class collector : public collectable::tracer {
+  public:
+    collector(std::vector<collectable *> &stack) : stack(stack) {}
+
+  protected:
+    virtual void visit(collectable *obj) {
+      if (obj->counts()->color == WHITE) {
+        obj->counts()->color = BLACK;
+        stack.push_back(obj);
+      }
+    }
+
+  private:
+    std::vector<collectable *> &stack;
+  };
+
+  if (obj->counts()->color != WHITE) return;
+
+  cycles_t &state = cycles();
+  collector visit(state.stack);
+  obj->counts()->color = BLACK;
+  state.stack.push_back(obj);
+  while (not state.stack.empty()) {
+    collectable *white = state.stack.back();
+    state.stack.pop_back();
+    white->trace(visit);
+    state.garbage.push_back(white);
+  }
+}
+
+/******************************
+ * memory::gc::collect_cycles *
+ ******************************/
+
+std::size_t memory::gc::collect_cycles(void) {
+  cycles_t &state = cycles();
+  if (state.collecting or state.roots.empty()) return 0;
+  state.collecting = true;
+
+  // Take the most recent possible roots from the buffer.
+  std::size_t count = state.roots.size();
+  if (cycle_budget and count > cycle_budget) count = cycle_budget;
+  std::vector<recyclable::counts_t *> roots(state.roots.end() - count,
+                                           state.roots.end());
+  state.roots.resize(state.roots.size() - count);
+  state.stats.collections++;
+  state.stats.examined += count;
+
+  /*  Roots that were destroyed since they were buffered are dropped, along
+   * with any that have been reached from an earlier root.
+   */
+  std::vector<collectable *> marked;
+  for (auto root: roots)
+    if (root->refs and root->color == PURPLE)
+      marked.push_back(static_cast<collectable *>((recyclable *)root));
+  for (auto root: marked)
+    if (root->counts()->color == PURPLE) mark_gray(root);
+  for (auto root: marked) scan(root);
+  for (auto root: marked) collect_white(root);
+
+  /*  The references the garbage holds were taken away by mark_gray, so
+   * they're given back before the garbage is unlinked from each other and
+   * released normally.
+   */
+  class restorer : public collectable::tracer {
+  protected:
+    virtual void visit(collectable *obj) { obj->counts()->refs++; }
+  } restore;
+
+  std::vector<reference<collectable> > garbage(state.garbage.begin(),
+                                               state.garbage.end());
+  state.garbage.clear();
+  for (auto &white: garbage) white->trace(restore);
+  for (auto &white: garbage) white->unlink();
+  std::size_t found = garbage.size();
+  state.stats.garbage += found;
+  garbage.clear();
+
+  // Release the buffer's weak references.
+  for (auto root: roots) {
+    root->buffered = 0;
+    if (recyclable::unweak(root) and root->refs == 0) recycle(block(root));
+  }
+
+  state.collecting = false;
+  return found;
+}
+
+/**************************
+ * memory::gc::cycles_due *
+ **************************/
+
+bool memory::gc::cycles_due(void) {
+  return (cycles().roots.size() >= cycle_threshold);
+}
+
+/***************************
+ * memory::gc::cycle_stats *
+ ***************************/
+
+memory::gc::cycle_stats_t memory::gc::cycle_stats(void) {
+  cycle_stats_t result = cycles().stats;
+  result.buffered = cycles().roots.size();
+  return result;
+}
+
+/*************************************
+ * memory::collectable::~collectable *
+ *************************************/
+
+memory::collectable::~collectable() throw() {
+  if (counts()->buffered) gc::forget_root(this);
 }
 
 /************************************
@@ -139,3 +1059,57 @@ void memory::recyclable::operator delete(void *ptr) noexcept {
 void memory::recyclable::operator delete[](void *ptr) noexcept {
   gc::recycle(ptr);
 }
+
+/******************************************************************************
+ * Weak Reference Overflow
+ *
+ *  Objects with more weak references than their counts can hold keep the
+ * rest here. The counts stay full while any are overflowed.
+ */
+
+typedef struct _weak_overflow_s {
+  std::mutex lock;
+  std::unordered_map<const memory::recyclable::counts_t *, std::size_t> counts;
+} weak_overflow_t;
+
+static weak_overflow_t &weak_overflow() {
+  static weak_overflow_t overflow;
+
+  return overflow;
+}
+
+/*************************************
+ * memory::recyclable::overflow_weak *
+ *************************************/
+
+void memory::recyclable::overflow_weak(counts_t *cnt) {
+  weak_overflow_t &overflow = weak_overflow();
+  std::lock_guard<std::mutex> hold(overflow.lock);
+  overflow.counts[cnt]++;
+  cnt->overflow = 1;
+}
+
+/**************************************
+ * memory::recyclable::underflow_weak *
+ **************************************/
+
+void memory::recyclable::underflow_weak(counts_t *cnt) {
+  weak_overflow_t &overflow = weak_overflow();
+  std::lock_guard<std::mutex> hold(overflow.lock);
+  auto entry = overflow.counts.find(cnt);
+  if (--entry->second == 0) {
+    overflow.counts.erase(entry);
+    cnt->overflow = 0;
+  }
+}
+
+/***************************************
+ * memory::recyclable::overflowed_weak *
+ ***************************************/
+
+std::size_t memory::recyclable::overflowed_weak(const counts_t *cnt) {
+  weak_overflow_t &overflow = weak_overflow();
+  std::lock_guard<std::mutex> hold(overflow.lock);
+  auto entry = overflow.counts.find(cnt);
+  return (entry == overflow.counts.end() ? 0 : entry->second);
+}
@@ -0,0 +1,7 @@
+#!/bin/sh
+#
+# Runs the test suite with every bytecode method compiled by the JIT the
+# first time it's sent.
+
+exec ../bin/meat --jit --jit-threshold=1 -i ../rtl/.libs/ -i ../lib/.libs/ \
+  tests.mlib
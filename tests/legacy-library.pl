@@ -0,0 +1,84 @@
+#! /usr/bin/perl -w
+#
+# Copyright (c) 2018 Ron R Wills <ron.rwsoft@gmail.com>
+#
+# This file is part of Meat.
+#
+# Meat is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# Meat is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with Meat.  If not, see <http://www.gnu.org/licenses/>.
+#
+#==============================================================================
+#
+#  Rewrites a library built by Grinder in the 1.0 library format, where the
+# virtual method table sizes are 8 bits instead of 16 bits. Grinder only
+# writes the current format, so this is how the tests get a 1.0 library to
+# import.
+#
+#  Usage: legacy-library.pl library.mlib
+
+use strict;
+
+my $file = shift or die "Usage: legacy-library.pl library.mlib\n";
+
+open(my $in, '<:raw', $file) or die "Unable to open $file: $!\n";
+my $lib = do { local $/; <$in> };
+close($in);
+
+my $pos = 0;
+sub take {
+  my ($count) = @_;
+  die "$file is truncated\n" if $pos + $count > length($lib);
+  my $bytes = substr($lib, $pos, $count);
+  $pos += $count;
+  return $bytes;
+}
+
+my ($magic, $major, $minor) = unpack('a4 C C', take(6));
+die "$file isn't a 1.1 library\n"
+  unless $magic eq 'MLIB' and $major == 1 and $minor == 1;
+my $legacy = pack('a4 C C', $magic, 1, 0);
+
+# The flags and the application class id.
+$legacy .= take(5);
+
+# The names of the imported libraries.
+my $imports = unpack('C', take(1));
+$legacy .= pack('C', $imports);
+for (1 .. $imports) {
+  my $end = index($lib, "\0", $pos);
+  die "$file is truncated\n" if $end < 0;
+  $legacy .= take($end - $pos + 1);
+}
+
+my $classes = unpack('C', take(1));
+$legacy .= pack('C', $classes);
+for (1 .. $classes) {
+  # The class ids and the number of properties.
+  $legacy .= take(10);
+
+  my ($entries, $centries) = unpack('n n', take(4));
+  die "$file has a class with too many methods for the 1.0 format\n"
+    if $entries > 255 or $centries > 255;
+  $legacy .= pack('C C', $entries, $centries);
+  $legacy .= take(12 * ($entries + $centries));
+
+  my $size = unpack('n', take(2));
+  $legacy .= pack('n', $size) . take($size);
+}
+
+# The symbols table is the same in both formats.
+$legacy .= substr($lib, $pos);
+
+open(my $out, '>:raw', $file) or die "Unable to write $file: $!\n";
+print $out $legacy;
+close($out);
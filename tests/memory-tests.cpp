@@ -17,8 +17,13 @@
  * along with Meat.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <meat.h>
 #include <meat/memory.h>
 #include <iostream>
+#include <vector>
+#include <thread>
+#include <algorithm>
+#include <cstring>
 #include <testsuite>
 
 /** The test object that keeps track of how many instances it has.
@@ -334,6 +339,35 @@ static bool ref_replace() {
   return tests.passed();
 }
 
+static bool ref_move() {
+  test::TestSuite tests("Moving References");
+	ref ptr1 = new TestObject;
+
+  test::Test &test_ctor = tests.test("Move Construction");
+	ref ptr2 = std::move(ptr1);
+  ref_examine(test_ctor, ptr1, true, false, 0, 0, 1) and
+  ref_examine(test_ctor, ptr2, false, false, 1, 0, 1);
+
+  test::Test &test_assign = tests.test("Move Assignment");
+	ptr1 = new TestObject;
+	ptr1 = std::move(ptr2);
+  ref_examine(test_assign, ptr2, true, false, 0, 0, 1) and
+  ref_examine(test_assign, ptr1, false, false, 1, 0, 1);
+
+  test::Test &test_weak = tests.test("Moving a Weak Reference");
+	ptr2 = ptr1.weak();
+	ref ptr3 = std::move(ptr2);
+  ref_examine(test_weak, ptr3, false, true, 1, 1, 1);
+
+  test::Test &test_result = tests.test("Moving a Result Reference");
+	ptr1 = ref_result();
+  ref_examine(test_result, ptr1, false, false, 1, 0, 1) and
+  ref_examine(test_result, ptr3, true, true, 0, 1, 1);
+
+  std::cout << tests << std::endl;
+  return tests.passed();
+}
+
 static ref global;
 
 static ref &get_reference() {
@@ -364,12 +398,589 @@ static bool weak_ref() {
   return tests.passed();
 }
 
+/** A recyclable test object, which keeps its reference counts itself.
+ */
+class TestRecyclable : public memory::recyclable {
+public:
+	static unsigned int count;
+
+	TestRecyclable() { ++count; }
+	virtual ~TestRecyclable() throw() { --count; }
+};
+
+unsigned int TestRecyclable::count = 0;
+
+typedef memory::reference<TestRecyclable> rref;
+
+static bool intrusive_ref() {
+  test::TestSuite tests("Intrusive References");
+  TestRecyclable *obj = new TestRecyclable;
+  rref ptr1 = obj;
+  rref ptr2 = obj;
+
+  test::Test &test_size = tests.test("Reference Size");
+  test_size << test::assert(sizeof(rref) == sizeof(void *))
+            << "A reference is " << sizeof(rref) << " bytes";
+
+  test::Test &test_raw = tests.test("Referencing the Same Object Twice");
+  test_raw << test::assert(ptr1.references() == 2 and ptr1 == ptr2)
+           << "References had " << ptr1.references() << " references";
+  if (test_raw)
+    test_raw << test::assert(TestRecyclable::count == 1)
+             << TestRecyclable::count << " objects != 1";
+
+  test::Test &test_weak = tests.test("Weak Reference");
+  rref weak = ptr1.weak();
+  test_weak << test::assert(weak.is_weak() and not weak.is_null())
+            << "Weak reference wasn't weak or was null";
+  if (test_weak)
+    test_weak << test::assert(weak == ptr1 and weak.weak_references() == 1)
+              << "Weak reference had " << weak.weak_references()
+              << " weak references";
+
+  test::Test &test_null = tests.test("Weak Reference to Null Object");
+  ptr1 = NULL;
+  ptr2 = NULL;
+  test_null << test::assert(weak.is_null() and weak.references() == 0)
+            << "Weak reference wasn't null";
+  if (test_null)
+    test_null << test::assert(weak.weak_references() == 1)
+              << "Weak reference had " << weak.weak_references()
+              << " weak references";
+  if (test_null)
+    test_null << test::assert(TestRecyclable::count == 0)
+              << TestRecyclable::count << " objects != 0";
+  if (test_null)
+    test_null << test::assert(weak.normal().is_null())
+              << "Normal reference to a null object wasn't null";
+
+  test::Test &test_free = tests.test("Releasing Last Weak Reference");
+  weak = NULL;
+  ptr1 = new TestRecyclable;
+  test_free << test::assert(ptr1 == obj)
+            << "The object's block wasn't recycled";
+
+  /*  The counts hold 24 bits of weak references, any more are kept in an
+   * overflow table.
+   */
+  test::Test &test_many = tests.test("More Weak References Than the Count");
+  const std::size_t many = 0x1000000 + 16;
+  std::vector<rref> weaks;
+  weaks.reserve(many);
+  for (std::size_t c = 0; c < many; ++c) weaks.push_back(ptr1.weak());
+  test_many << test::assert(ptr1.weak_references() == many)
+            << "Weak references counted " << ptr1.weak_references()
+            << " != " << many;
+  ptr1 = NULL;
+  weaks.resize(1);
+  if (test_many)
+    test_many << test::assert(weaks[0].weak_references() == 1 and
+                              TestRecyclable::count == 0)
+              << "Weak references counted " << weaks[0].weak_references()
+              << " != 1";
+  weaks.clear();
+  ptr1 = new TestRecyclable;
+  if (test_many)
+    test_many << test::assert(ptr1 == obj)
+              << "The object's block wasn't recycled";
+
+  std::cout << tests << std::endl;
+  return tests.passed();
+}
+
+/** A collectable test object that can reference other nodes.
+ */
+class TestNode : public memory::collectable {
+public:
+	static unsigned int count;
+
+	TestNode() { ++count; }
+	virtual ~TestNode() throw() { --count; }
+
+	virtual void trace(tracer &visit) { visit(next); visit(other); }
+	virtual void unlink() { next = NULL; other = NULL; }
+
+	memory::reference<TestNode> next;
+	memory::reference<TestNode> other;
+};
+
+unsigned int TestNode::count = 0;
+
+typedef memory::reference<TestNode> nref;
+
+static bool cycle_collector() {
+  test::TestSuite tests("Cycle Collector");
+  memory::gc::cycle_stats_t before = memory::gc::cycle_stats();
+
+  test::Test &test_pair = tests.test("Collecting a Cycle");
+  nref node1 = new TestNode;
+	node1->next = new TestNode;
+	node1->next->next = node1;
+  nref weak = node1.weak();
+  node1 = NULL;
+  test_pair << test::assert(TestNode::count == 2)
+            << "Cycle was released by reference counting";
+  if (test_pair) {
+    std::size_t found = memory::gc::collect_cycles();
+    test_pair << test::assert(found == 2 and TestNode::count == 0)
+              << found << " objects found, " << TestNode::count
+              << " objects left";
+  }
+  if (test_pair)
+    test_pair << test::assert(weak.is_null())
+              << "Weak reference to the cycle wasn't null";
+
+  test::Test &test_self = tests.test("Collecting a Self Reference");
+  node1 = new TestNode;
+  node1->next = node1;
+  node1 = NULL;
+  memory::gc::collect_cycles();
+  test_self << test::assert(TestNode::count == 0)
+            << TestNode::count << " objects left";
+
+  test::Test &test_live = tests.test("Keeping a Referenced Cycle");
+  node1 = new TestNode;
+	node1->next = new TestNode;
+	node1->next->next = node1;
+  nref node2 = node1->next;
+  node1 = NULL;
+  memory::gc::collect_cycles();
+  test_live << test::assert(TestNode::count == 2)
+            << TestNode::count << " objects left (!= 2)";
+  if (test_live)
+    test_live << test::assert(node2.references() == 2 and
+                              node2->next.references() == 1)
+              << "Reference counts were changed to " << node2.references()
+              << " and " << node2->next.references();
+
+  test::Test &test_out = tests.test("Garbage Referencing Live Objects");
+  nref live = new TestNode;
+  node2->other = live;
+  node2 = NULL;
+  memory::gc::collect_cycles();
+  test_out << test::assert(TestNode::count == 1 and live.references() == 1)
+           << TestNode::count << " objects left, live object has "
+           << live.references() << " references";
+  live = NULL;
+
+  test::Test &test_ring = tests.test("Collecting a Large Cycle");
+  nref first = new TestNode, last = first;
+  for (unsigned int c = 0; c < 100000; ++c) {
+    last->next = new TestNode;
+    last = last->next;
+  }
+  last->next = first;
+  first = last = NULL;
+  std::size_t budget = memory::gc::cycle_budget;
+  memory::gc::cycle_budget = 0;
+  memory::gc::collect_cycles();
+  memory::gc::cycle_budget = budget;
+  test_ring << test::assert(TestNode::count == 0)
+            << TestNode::count << " objects left";
+
+  test::Test &test_stats = tests.test("Cycle Collector Statistics");
+  memory::gc::cycle_stats_t after = memory::gc::cycle_stats();
+  test_stats << test::assert(after.collections == before.collections + 5)
+             << after.collections - before.collections
+             << " collections (!= 5)";
+  if (test_stats)
+    test_stats << test::assert(after.garbage == before.garbage + 100006)
+               << after.garbage - before.garbage
+               << " garbage objects (!= 100006)";
+
+  std::cout << tests << std::endl;
+  return tests.passed();
+}
+
+static bool immediate_ref() {
+  test::TestSuite tests("Immediate References");
+
+  test::Test &test_value = tests.test("Immediate Value");
+  rref value = rref::immediate(-5);
+  test_value << test::assert(value.is_immediate() and value.immediate() == -5)
+             << "The reference held " << value.immediate();
+  if (test_value)
+    test_value << test::assert(not value.is_null() and not value.is_weak() and
+                               value.references() == 0)
+               << "The immediate reference looked like an object";
+
+  test::Test &test_copy = tests.test("Copying an Immediate Value");
+  rref copy = value;
+  rref weak = value.weak();
+  test_copy << test::assert(copy == value and copy.immediate() == -5)
+            << "The copy held " << copy.immediate();
+  if (test_copy)
+    test_copy << test::assert(weak == value and not weak.is_weak() and
+                              value.normal() == value)
+              << "Weak and normal references to the value were different";
+
+  test::Test &test_range = tests.test("Immediate Range");
+  test_range << test::assert(rref::fits_immediate(INT32_MIN) and
+                             rref::fits_immediate(INT32_MAX) ==
+                             (sizeof(void *) > 4))
+             << "32 bit integers don't fit as expected";
+  if (test_range)
+    test_range << test::assert(
+      rref::fits_immediate(rref::IMMEDIATE_MIN) and
+      not rref::fits_immediate((std::intmax_t)rref::IMMEDIATE_MAX + 1))
+               << "The range limits aren't right";
+  if (test_range) {
+    rref min = rref::immediate(rref::IMMEDIATE_MIN);
+    rref max = rref::immediate(rref::IMMEDIATE_MAX);
+    test_range << test::assert(min.immediate() == rref::IMMEDIATE_MIN and
+                               max.immediate() == rref::IMMEDIATE_MAX)
+               << "The range limits didn't survive the reference";
+  }
+
+  test::Test &test_objects = tests.test("Immediate Values Aren't Objects");
+  unsigned int recyclables = TestRecyclable::count;
+  rref object = new TestRecyclable;
+  object = rref::immediate(7);
+  test_objects << test::assert(TestRecyclable::count == recyclables)
+               << "Replacing an object with a value didn't release it";
+  if (test_objects) {
+    nref node = new TestNode;
+    node->next = memory::reference<TestNode>::immediate(7);
+    node->other = node;
+    node = NULL;
+    memory::gc::collect_cycles();
+    test_objects << test::assert(TestNode::count == 0)
+                 << "A cycle holding a value wasn't collected";
+  }
+
+  std::cout << tests << std::endl;
+  return tests.passed();
+}
+
+/** A recyclable object of a given size for testing the allocator.
+ */
+template <std::size_t Size>
+class Recycled : public memory::recyclable {
+public:
+  char data[Size];
+};
+
+/**************
+ * size_class *
+ **************/
+
+static memory::gc::size_class_t size_class(std::size_t size) {
+  for (std::size_t c = 0; c < memory::gc::size_classes(); ++c) {
+    memory::gc::size_class_t occupancy = memory::gc::occupancy(c);
+    if (occupancy.block_size >= size) return occupancy;
+  }
+  return memory::gc::size_class_t{0, 0, 0, 0};
+}
+
+/***************
+ * total_slabs *
+ ***************/
+
+static std::size_t total_slabs() {
+  std::size_t slabs = 0;
+  for (std::size_t c = 0; c < memory::gc::size_classes(); ++c)
+    slabs += memory::gc::occupancy(c).slabs;
+  return slabs;
+}
+
+static bool slab_allocator() {
+  test::TestSuite tests("Slab Allocator");
+  std::vector<Recycled<48> *> objects;
+  const std::size_t object_size = sizeof(Recycled<48>);
+  memory::gc::size_class_t before = size_class(object_size);
+
+  test::Test &test_alloc = tests.test("Allocating Objects");
+  for (unsigned int c = 0; c < 1000; ++c)
+    objects.push_back(new Recycled<48>);
+  memory::gc::size_class_t during = size_class(object_size);
+  test_alloc << test::assert(during.used == before.used + 1000)
+             << during.used - before.used << " blocks used (!= 1000)";
+  if (test_alloc)
+    test_alloc << test::assert(during.blocks >= during.used)
+               << during.blocks << " blocks for " << during.used << " used";
+
+  test::Test &test_reuse = tests.test("Reusing Recycled Blocks");
+  Recycled<48> *last = objects.back();
+  delete last;
+  objects.back() = new Recycled<48>;
+  test_reuse << test::assert(objects.back() == last)
+             << "The recycled block wasn't reused";
+
+  test::Test &test_recycle = tests.test("Recycling Objects");
+  for (auto object: objects) delete object;
+  objects.clear();
+  memory::gc::size_class_t after = size_class(object_size);
+  test_recycle << test::assert(after.used == before.used)
+               << after.used - before.used << " blocks still used";
+
+  test::Test &test_medium = tests.test("Reusing Medium Sized Blocks");
+  Recycled<3000> *medium = new Recycled<3000>;
+  memory::gc::size_class_t holding = size_class(sizeof(*medium));
+  delete medium;
+  test_medium << test::assert(holding.block_size >= sizeof(*medium) and
+                              holding.block_size < 2 * sizeof(*medium) and
+                              holding.used > 0)
+              << "A " << sizeof(*medium) << " byte object wasn't in the "
+              << holding.block_size << " byte size class";
+  if (test_medium) {
+    Recycled<3000> *again = new Recycled<3000>;
+    test_medium << test::assert(again == medium)
+                << "The recycled block wasn't reused";
+    delete again;
+  }
+
+  test::Test &test_large = tests.test("Large Objects");
+  Recycled<16384> *large = new Recycled<16384>;
+  std::memset(large->data, 0xaa, sizeof(large->data));
+  delete large;
+  test_large << test::assert(size_class(object_size).used == before.used)
+             << "Large object changed the size classes";
+  if (test_large)
+    test_large << test::assert(size_class(sizeof(*large)).block_size == 0)
+               << "A " << sizeof(*large) << " byte object had a size class";
+
+  test::Test &test_size = tests.test("Block Sizes");
+  large = new Recycled<16384>;
+  test_size << test::assert(memory::gc::block_size(large) >= sizeof(*large))
+            << memory::gc::block_size(large) << " bytes for a large object";
+  delete large;
+  objects.push_back(new Recycled<48>);
+  if (test_size)
+    test_size << test::assert(memory::gc::block_size(objects.back()) ==
+                              during.block_size and
+                              memory::gc::block_size(objects.back()->data +
+                                                     40) == during.block_size)
+              << memory::gc::block_size(objects.back()) << " bytes (!= "
+              << during.block_size << ")";
+  delete objects.back();
+  objects.clear();
+
+  test::Test &test_stats = tests.test("Allocator Statistics");
+  memory::gc::stats_t start = memory::gc::stats();
+  for (unsigned int c = 0; c < 100; ++c)
+    objects.push_back(new Recycled<48>);
+  memory::gc::stats_t middle = memory::gc::stats();
+  test_stats << test::assert(middle.allocations == start.allocations + 100)
+             << middle.allocations - start.allocations
+             << " allocations counted (!= 100)";
+  if (test_stats)
+    test_stats << test::assert(middle.bytes ==
+                               start.bytes + 100 * during.block_size)
+               << middle.bytes - start.bytes << " bytes counted";
+  if (test_stats)
+    test_stats << test::assert(middle.reused == start.reused + 100)
+               << "Recycled blocks weren't counted as reused";
+  if (test_stats)
+    test_stats << test::assert(middle.peak_bytes >= middle.bytes)
+               << "The peak is less than the bytes allocated";
+  for (auto object: objects) delete object;
+  objects.clear();
+  memory::gc::stats_t end = memory::gc::stats();
+  if (test_stats)
+    test_stats << test::assert(end.recycled == start.recycled + 100 and
+                               end.bytes == start.bytes)
+               << "Recycled blocks weren't counted";
+
+  test::Test &test_step = tests.test("Budgeted Collection Steps");
+  for (unsigned int c = 0; c < 4 * during.blocks; ++c)
+    objects.push_back(new Recycled<48>);
+  for (auto object: objects) delete object;
+  objects.clear();
+
+  std::size_t limit = memory::gc::limit;
+  std::size_t budget = memory::gc::collection_budget;
+  memory::gc::limit = 0;
+  memory::gc::collection_budget = 1;
+  std::size_t slabs = total_slabs();
+  test_step << test::assert(memory::gc::collection_due())
+            << "Empty slabs over the limit didn't make a step due";
+  memory::gc::collect();
+  if (test_step)
+    test_step << test::assert(total_slabs() == slabs - 1)
+              << slabs - total_slabs() << " slabs given back (!= 1)";
+  memory::gc::limit = limit;
+  memory::gc::collection_budget = budget;
+
+  test::Test &test_collect = tests.test("Returning Empty Slabs");
+  memory::gc::collect_all();
+  after = size_class(object_size);
+  test_collect << test::assert(after.slabs <= before.slabs)
+               << after.slabs << " slabs kept (> " << before.slabs << ")";
+
+  std::cout << tests << std::endl;
+  return tests.passed();
+}
+
+/** Recycles and allocates blocks as a thread exits, after the thread's heap
+ * has already been abandoned.
+ */
+class ExitingObjects {
+public:
+  std::vector<Recycled<48> *> objects;
+
+  ~ExitingObjects() {
+    for (auto object: objects) delete object;
+    objects.clear();
+    delete new Recycled<48>;
+  }
+};
+
+static thread_local ExitingObjects exiting_objects;
+
+static bool thread_heaps() {
+  test::TestSuite tests("Thread Heaps");
+  std::vector<Recycled<48> *> objects;
+  const std::size_t object_size = sizeof(Recycled<48>);
+  std::size_t before = size_class(object_size).used;
+
+  test::Test &test_remote = tests.test("Recycling Another Thread's Blocks");
+  for (unsigned int c = 0; c < 1000; ++c)
+    objects.push_back(new Recycled<48>);
+  std::thread recycler([&objects]() {
+      for (auto object: objects) delete object;
+    });
+  recycler.join();
+  objects.clear();
+  memory::gc::collect();
+  std::size_t after = size_class(object_size).used;
+  test_remote << test::assert(after == before)
+              << after - before << " blocks still used";
+
+  test::Test &test_adopt = tests.test("Adopting Abandoned Heaps");
+  std::thread allocator([&objects]() {
+      for (unsigned int c = 0; c < 1000; ++c)
+        objects.push_back(new Recycled<48>);
+    });
+  allocator.join();
+  for (auto object: objects) delete object;
+  objects.clear();
+  std::thread adopter([]() { memory::gc::collect(); });
+  adopter.join();
+  after = size_class(object_size).used;
+  test_adopt << test::assert(after == before)
+             << after - before << " blocks still used";
+
+  test::Test &test_exit = tests.test("Recycling While a Thread Exits");
+  std::thread exiting([]() {
+      // The objects are destroyed after the heap's guard is.
+      exiting_objects.objects.clear();
+      for (unsigned int c = 0; c < 1000; ++c)
+        exiting_objects.objects.push_back(new Recycled<48>);
+    });
+  exiting.join();
+  std::thread drainer([]() { memory::gc::collect(); });
+  drainer.join();
+  after = size_class(object_size).used;
+  test_exit << test::assert(after == before)
+            << after - before << " blocks still used";
+
+  test::Test &test_threads = tests.test("Allocating From Several Threads");
+  std::vector<std::thread> threads;
+  for (unsigned int t = 0; t < 4; ++t) {
+    threads.push_back(std::thread([]() {
+          std::vector<Recycled<48> *> mine;
+          for (unsigned int round = 0; round < 100; ++round) {
+            for (unsigned int c = 0; c < 1000; ++c)
+              mine.push_back(new Recycled<48>);
+            for (auto object: mine) delete object;
+            mine.clear();
+          }
+        }));
+  }
+  for (auto &thread: threads) thread.join();
+  after = size_class(object_size).used;
+  test_threads << test::assert(after == before)
+               << after - before << " blocks still used";
+
+  /*  Two threads hold the same number of bytes one after the other, so the
+   * peak should only go up by what one of them held.
+   */
+  test::Test &test_peak = tests.test("Peak Bytes Across Threads");
+  typedef Recycled<1024 * 1024> Huge;
+  const std::size_t held = 8 * sizeof(Huge);
+  memory::gc::stats_t start = memory::gc::stats();
+  for (unsigned int t = 0; t < 2; ++t) {
+    std::thread holder([]() {
+        std::vector<Huge *> mine;
+        for (unsigned int c = 0; c < 8; ++c) mine.push_back(new Huge);
+        for (auto object: mine) delete object;
+      });
+    holder.join();
+  }
+  memory::gc::stats_t end = memory::gc::stats();
+  test_peak << test::assert(end.peak_bytes >= start.bytes + held - held / 8)
+            << "The peak of " << end.peak_bytes << " missed the "
+            << held << " bytes a thread held";
+  if (test_peak)
+    test_peak << test::assert(end.peak_bytes <
+                              std::max(start.peak_bytes,
+                                       start.bytes + held) + held / 2)
+              << "The peak of " << end.peak_bytes
+              << " added the threads' peaks together";
+
+  std::cout << tests << std::endl;
+  return tests.passed();
+}
+
+/****************
+ * lookup_cache *
+ ****************/
+
+static bool lookup_cache() {
+  test::TestSuite tests("Method Lookup Cache");
+
+  const char *args[] = {"memory-tests", nullptr};
+  meat::initialize(1, args);
+  meat::Reference object = meat::Class::resolve("Object");
+
+  test::Test &test_hit = tests.test("Repeated Send Hits the Cache");
+  meat::message(object, "name", meat::Null());
+  meat::lookup_stats_t before = meat::lookup_stats();
+  meat::message(object, "name", meat::Null());
+  meat::lookup_stats_t after = meat::lookup_stats();
+  test_hit << test::assert(after.hits == before.hits + 1 and
+                           after.misses == before.misses)
+           << after.hits - before.hits << " hits and "
+           << after.misses - before.misses << " misses";
+
+  test::Test &test_record = tests.test("Recording a Class Flushes the Cache");
+  meat::Class::record(new meat::Class("Object"), "TestLookupClass");
+  before = meat::lookup_stats();
+  meat::message(object, "name", meat::Null());
+  after = meat::lookup_stats();
+  test_record << test::assert(after.misses == before.misses + 1)
+              << "The send after recording a class missed "
+              << after.misses - before.misses << " times";
+
+  test::Test &test_relink = tests.test("Relinking a Class Flushes the Cache");
+  meat::message(object, "name", meat::Null());
+  meat::cast<meat::Class>(object).relink();
+  before = meat::lookup_stats();
+  meat::message(object, "name", meat::Null());
+  after = meat::lookup_stats();
+  test_relink << test::assert(after.misses == before.misses + 1)
+              << "The send after relinking missed "
+              << after.misses - before.misses << " times";
+
+  meat::cleanup();
+
+  std::cout << tests << std::endl;
+  return tests.passed();
+}
+
 int main(int argc, char *argv[]) {
 	int result = 0;
 
 	if (not basic_ref_counting()) result = 1;
 	if (not ref_replace()) result = 1;
+	if (not ref_move()) result = 1;
 	if (not weak_ref()) result = 1;
+	if (not intrusive_ref()) result = 1;
+	if (not cycle_collector()) result = 1;
+	if (not immediate_ref()) result = 1;
+	if (not slab_allocator()) result = 1;
+	if (not thread_heaps()) result = 1;
+	if (not lookup_cache()) result = 1;
 
 	return result;
 }
@@ -0,0 +1,35 @@
+#!/bin/sh
+#
+# Writes a heap snapshot of a known object graph and checks the sizes
+# meat-grinder -d reports are retained by it. The holder is the only
+# reference to its four leaves, so it retains them and the leaves retain
+# only themselves.
+
+../bin/meat -i ../rtl/.libs/ snapshot.mlib || exit 1
+../bin/meat-grinder -d snapshot.mhsp > snapshot.out || exit 1
+
+# The class rows are the name followed by objects, shallow and retained.
+exec awk '
+  NF == 4 && $1 == "SnapshotHolder" {
+    holders = $2; holder_shallow = $3; holder_retained = $4
+  }
+  NF == 4 && $1 == "SnapshotLeaf" {
+    leaves = $2; leaf_shallow = $3; leaf_retained = $4
+  }
+  END {
+    if (holders != 1 || leaves != 4) {
+      print "FAIL: " holders " holders and " leaves " leaves in the snapshot"
+      exit 1
+    }
+    if (leaf_shallow <= 0 || leaf_retained != leaf_shallow) {
+      print "FAIL: the leaves retain " leaf_retained " of " leaf_shallow \
+            " bytes"
+      exit 1
+    }
+    if (holder_retained != holder_shallow + leaf_shallow) {
+      print "FAIL: the holder retains " holder_retained " bytes, not " \
+            holder_shallow + leaf_shallow
+      exit 1
+    }
+    print "PASS: the holder retains " holder_retained " bytes"
+  }' snapshot.out